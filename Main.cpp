@@ -22,20 +22,163 @@
 @section compile_section Compiling and Usage
 
 @par Compiling Instructions:
-	All:
-		0. Go to dictionary.h and set the defines to fit your needs.
 	MSVC++:
 		1. Create a new program.
-		2. Add Main.cpp and dictionary.cpp to your source files.
-		3. Add dictionary.h to your header files.
-		4. Compile
+		2. Add Main.cpp, arena.cpp, decompressor.cpp, dictionary.cpp,
+		   histogram.cpp, mappedfile.cpp, ngrams.cpp, pipeline.cpp,
+		   report.cpp, shareddictionary.cpp, sketch.cpp, snapshot.cpp,
+		   streamreader.cpp, tokenizer.cpp, topk.cpp, and unicode.cpp to your
+		   source files.
+		3. Add alphabets.h, arena.h, decompressor.h, dictionary.h,
+		   histogram.h, keys.h, mappedfile.h, ngrams.h, pipeline.h, report.h,
+		   ring.h, shareddictionary.h, sketch.h, snapshot.h, streamreader.h,
+		   tokenizer.h, topk.h, and unicode.h to your header files.
+		4. Link zlib for gzip input, and zstd for zstd input, if you have
+		   them.
+		5. To count words of another alphabet, define ALPHABET as
+		   alphanumeric, hyphenated, or utf8 in the preprocessor
+		   definitions.
+		6. Compile
 	GCC:
-		1. Place Main.cpp, dictionary.h, and dictionary.cpp in a directory.
+		1. Place all of the .cpp and .h files in a directory.
 		2. CD to that directory.
-		3. Run the following command.
-		   g++ -march=native -O3 -funsafe-loop-optimizations -fno-math-errno -ffinite-math-only -fno-signed-zeros -fno-trapping-math -std=gnu++11 dictionary.h dictionary.cpp Main.cpp -lquadmath -o zipf
+		3. Run the following command. Add -lzstd to read zstd input, or
+		   leave out -lz if zlib isn't installed. Add -DALPHABET=utf8, or
+		   alphanumeric or hyphenated, to count words of another alphabet.
+		   g++ -march=native -O3 -std=gnu++17 -pthread arena.cpp decompressor.cpp dictionary.cpp histogram.cpp mappedfile.cpp ngrams.cpp pipeline.cpp report.cpp shareddictionary.cpp sketch.cpp snapshot.cpp streamreader.cpp tokenizer.cpp topk.cpp unicode.cpp Main.cpp -lz -o zipf
 
-@par Usage: <program_name> <text_file>
+@par Usage: <program_name> [options] <text_file>...
+	@verbatim
+	<text_file> may be "-" to read from standard input. Standard input, pipes,
+	and anything else that can't be memory mapped are read one block at a
+	time, so the text never has to be saved to disk first. Reading,
+	tokenizing, and counting each get their own thread, so they overlap.
+
+	Text compressed with gzip (.gz) or zstd (.zst) is decompressed as it's
+	read, from a file or a pipe, if the program was built with zlib or zstd.
+	Files made by bgzip or pzstd, or of several zstd frames, are
+	decompressed on several threads at once: -j of them, or one per CPU.
+	If the compressed data is corrupt or cut off, or the input can't be
+	read, an error is printed, no results are written or saved, and the
+	program exits with a non-zero status.
+
+	A word is made of the letters A-z, with apostrophes inside it, unless
+	the program was compiled with -DALPHABET set to one of these:
+	  alphanumeric  A-z and 0-9, as in "mp3" or "1984".
+	  hyphenated    A-z, with hyphens inside a word too, as in "co-op".
+	  utf8          Letters of any script in UTF-8, as in "naïve" or
+	                "привет". They're case folded, so "ΣΊΣΥΦΟΣ" and
+	                "σίσυφος" are one word, unless the folded letter is
+	                a different length in UTF-8, as "ẞ" to "ß" is. "ß"
+	                isn't folded to "ss". Words in scripts written
+	                without spaces, such as Chinese, aren't split up.
+	                Words are lined up in the .wrd file by the columns
+	                they take, not their bytes.
+	                Words outside of ASCII are looked at one by one for
+	                -r, so it's slower.
+	Snapshots can only be read by a program compiled with the same
+	alphabet.
+
+	If more than one text file is given, or a directory, every file (and
+	every file in every directory, recursively) is counted separately, with
+	its results written next to it. Several files are counted at once, one
+	per thread, and each thread reuses its dictionary from file to file.
+	The results of "x.txt" go to "x.wrd" and "x.csv", unless another file,
+	such as "x.md" or "x.txt.gz", or the -a files would get the same
+	names. Then they go to "x.txt.wrd" and "x.txt.csv". A file that is
+	given more than once, or found again in a directory, is counted once.
+
+	-j <N>    Count words with N threads. The file is split into N chunks,
+	          each counted into its own dictionary, and then merged. With
+	          several files, N files are counted at once instead. Defaults
+	          to 1 for one file, and the number of CPUs for several.
+	--shared  With -j and one file, count every chunk into one dictionary
+	          that all N threads insert into at once, instead of one
+	          dictionary per thread that are merged at the end. Each word
+	          is only stored once, so this takes far less memory when the
+	          text has many different words. Not with -t, -c, -p, -r,
+	          --save, or --load.
+	--pipeline Read <text_file> one block at a time, the way standard input
+	          is read, instead of mapping it. One thread reads, another
+	          tokenizes, and a third counts, so on a slow disk or network
+	          file system the time spent waiting on reads is hidden behind
+	          counting. -j only sets the number of threads to decompress
+	          with, since the counting is done on one thread, and a snapshot
+	          is read as text.
+	--follow <S> Keep reading <text_file> as it grows, like tail -f, and
+	          rewrite the results every S seconds while new words are
+	          being added to it, until the program is stopped with Ctrl-C.
+	          Only what was written since the last check is read, so
+	          keeping up with a log only takes as long as counting what's
+	          added to it. The file is checked a few times a second. If it
+	          gets shorter, it was truncated or rotated, and is read again
+	          from the start, adding to the counts. The results are
+	          written one last time when the program is stopped, and saved
+	          with --save. Only for one text file that isn't compressed,
+	          and not with -j, --shared, --pipeline, -p, or -r. A snapshot
+	          is read as text.
+	-k <N>    Use N bit keys in the dictionary, where N is 64 or 128. By
+	          default this is picked by sampling the lengths of the words in
+	          the file.
+	-i        Resize the dictionary incrementally, a few spots per insert,
+	          instead of all at once. This keeps any one insert from taking
+	          too long, but is slower overall.
+	--stats   Write how the dictionary performed, such as how long its
+	          probes were and how often it resized, to <text_file>.json.
+	          Only available when compiled with -DDICT_STATS.
+	-o <P>    Write the results to <P>.wrd and <P>.csv. By default, this is
+	          <text_file> without its extension, or "stdin". Only for one
+	          text file.
+	-a <P>    Also count the words of every file together, and write the
+	          results to <P>.wrd and <P>.csv.
+	-t <K>    Only keep counts for the K most frequent words, so memory use
+	          doesn't grow with the number of different words. Counts may be
+	          too high by up to the "Max Error" printed in the results, which
+	          is at most the total number of words divided by K. Only for one
+	          text file.
+	-c <W>x<D> Count approximately with a Count-Min sketch of D rows of W
+	          counters, in W * D * 4 bytes no matter how big the text is.
+	          Only the heaviest words are printed: 1000 of them, or K with
+	          -t. Counts may be too high by up to the "Max Error" printed in
+	          the results, e / W times the total number of words, with the
+	          probability printed next to it, 1 - e^-D. For example, -c
+	          1000000x4 is off by less than 0.0003% of the words 98% of the
+	          time. Only for one text file.
+	-n <N>    Also count every run of 2 words in a row, and of 3 if N is 3,
+	          in the same pass, and write them like the words are, to
+	          <P>.2.wrd and <P>.2.csv, and <P>.3.wrd and <P>.3.csv. Each
+	          word is stored once, and an n-gram is only the ids of its
+	          words. The runs go across line breaks and punctuation, but
+	          not from one file to the next. Only for one text file, and
+	          not with -j, --shared, -t, -c, -p, -r, --save, or --load.
+	-p <P>    Print every word that starts with P, and its count, one per
+	          line, instead of writing <text_file>.wrd and .csv. Only the
+	          words that match are read from the dictionary, since it keeps
+	          its words in alphabetical order. The times are printed to
+	          standard error instead, so only the words go to standard
+	          output. Only for one text file, and not with -t or -c.
+	-r <A>:<B> Like -p, but print every word from A to B alphabetically,
+	          including A and B. Either may be left out, as in -r :m.
+	--save <F> After counting, save the dictionary to the snapshot file F,
+	          as well as writing the results. Not with -t or -c.
+	--load <F> Start from the dictionary saved in the snapshot file F, and
+	          count the text into it, so the results are for both. Its keys
+	          are the size it was saved with. Only for one text file.
+
+	If <text_file> is a snapshot, nothing is counted: the dictionary is
+	used right where it is in the file, with no loading, and its results
+	are written or queried with -p or -r as if the text it was saved from
+	had just been counted.
+
+	--merge   Merge snapshots, such as ones saved on different machines from
+	          different parts of a corpus, instead of counting text. Every
+	          <text_file> must be a snapshot, all with keys of the same size.
+	          They are read in alphabetical order all at once, so merging
+	          takes almost no memory. The merged snapshot is saved to the
+	          --save file, or <P>.snap, and its results are written to
+	          <P>.wrd and <P>.csv, or queried with -p or -r. <P> is the -o
+	          name, or "merged".
+	@endverbatim
 
 @section todo_bugs_changelog Todo, Bugs, and Changelog
 
@@ -147,15 +290,254 @@
 	November 30, 2015	Full testing shows a 60% performance increase from the
 						code before Nov 26 to the current code, using BFN_DEF 3
 						before, and BFN_DEF 1 with BLOOMISH now.
+	October 16, 2026	Input files are now memory mapped instead of read
+						through a std::ifstream, and getword() returns a
+						std::string_view into the mapping. The dictionary
+						takes std::string_view, so a word is only copied when
+						it is new. Requires C++17 now. getword() no longer
+						stops at a 0xFF byte, and tiny files no longer make
+						the dictionary resize forever.
+
+						Added -j option to count words on several threads.
+						Added dictionary::merge(), which merges two
+						dictionaries in a single pass since both are already
+						in hash order. logTime() now shows wall clock time.
+
+						Replaced getword() with the tokenizer class, which
+						finds words 32 bytes at a time with AVX2 (or 16 with
+						SSE2, or 1 without either) and lowercases them in the
+						same pass. The instruction set is picked at runtime.
+
+						Words are now allocated from an arena owned by the
+						dictionary, with their characters stored right after
+						the word struct, instead of with 'new'. Added
+						dictionary::clear().
+
+						Changed dictionary list from an array of word pointers
+						to parallel arrays of hashes, 32-bit counts, and word
+						pointers. Probing now only reads the hashes. Counts
+						that don't fit in 32 bits are moved to the word
+						struct. Fixed dictionary::remove() clearing the wrong
+						spot after moving words up.
+
+						Replaced the floating point hash with integer keys
+						that pack 5 bits per letter exactly, and made the
+						dictionary a template over the key type. Removed
+						BFN_DEF, BLOOMISH, and POW28. Both 64 and 128 bit keys
+						are compiled in, and the size is picked at runtime by
+						sampling the word lengths in the file, or with -k.
+
+						Added -i option and dictionary::incremental(). When
+						on, resizing keeps the old list and moves a few spots
+						of it per insert() or remove(), so no single call has
+						to move every word. Removed the "Resizing List"
+						message.
+
+						Added bench.cpp, a separate program that times every
+						dictionary operation for each key size, resizing mode,
+						table size, load factor, and find hit ratio, and
+						writes the throughput and latency percentiles as CSV
+						or JSON.
+
+						Added --stats option, which writes probe lengths,
+						clusters, string compares, resizes, and load factor
+						over time to a .json file. It is only compiled in
+						with -DDICT_STATS, so normal builds don't pay for it.
+
+						Added streamreader class, which reads standard input
+						or pipes in 1 MiB blocks, carrying a word cut off at
+						the end of a block into the next. Passing "-" as the
+						file reads standard input. The dictionary starts small
+						and grows as needed, since there is no file size. Added
+						-o option to name the output files. Split printing the
+						results out of countFile() into printFiles().
+
+						Added batch mode. Any number of files and directories
+						can be given, and they are counted on a pool of
+						threads that each take the next file when they finish
+						one. Each thread keeps one dictionary and clears it
+						between files. Added -a option to also write the
+						totals across every file. The output name now only
+						strips the extension from the last part of the path.
+						A file listed twice is counted once, and files whose
+						output names would be the same keep their extensions
+						in them, so that no two write the same files.
+
+						Added -t option and topk class, which counts only the
+						K most frequent words with the Space-Saving algorithm.
+						Moved the printing of words by frequency out of
+						dictionary::print() into the report class, so topk
+						prints the same way.
+
+						Added -c option and sketch class, which counts
+						approximately with a conservative update Count-Min
+						sketch of a given width and depth, and keeps its
+						heaviest words in a topk, where they are counted
+						exactly from then on. The error bound and its
+						probability are printed in the headers. Added
+						topk::add() and topk::offer() for it.
+
+						Added dictionary::prefix() and dictionary::range(),
+						which find the words with a prefix, or between two
+						words, by locating the first one and reading forward,
+						since the list is in alphabetical order. Added -p and
+						-r options to print them instead of the results files.
+						The times are logged to standard error with -p or -r,
+						so their words can be piped.
+
+						Rewrote the report stage. dictionary::print() sorts
+						the words by count with a counting sort instead of a
+						vector as long as the highest count, and the report
+						only keeps pointers to the words. The numbers are
+						formatted with std::to_chars into 1 MiB buffers, and
+						the .wrd and .csv files are written on two threads.
+						The output is unchanged.
+
+						Added --save and --load, which save a dictionary to a
+						binary snapshot file and start from one, and let a
+						snapshot be given instead of a text file, to write
+						its results or query it straight from the mapped file.
+						Added snapshot.h/.cpp. Moved the counting sort from
+						dictionary::print() to report::byCount(), so that a
+						snapshot can print itself the same way. Opening a
+						snapshot checks its offsets and counts against its
+						header, so a damaged one is rejected.
+
+						Added --merge, which merges any number of snapshots
+						into one with snapshot::merge(), reading them all in
+						alphabetical order at once, and writes the results of
+						the merged snapshot. Added snapshot::layout() for the
+						header, which dictionary::save() uses too.
+
+						Added dictionary::insertBatch() and findBatch(), and
+						countWords() now inserts each block of words with
+						insertBatch(). Repeated words in a block are counted
+						together before they're inserted, and the spots of the
+						words are loaded a few words ahead.
+
+						Added --shared, which counts every chunk of -j into
+						one shareddictionary instead of a dictionary per
+						thread. Threads add new words with a compare and swap
+						and count old ones with an atomic add, and all of them
+						help move the table when it resizes. Added
+						shareddictionary.h/.cpp, and printHeaders() for the
+						headers every dictionary prints the same way.
+
+						Streams are now read through a pipeline, with reading,
+						tokenizing, and counting on three threads connected by
+						rings, so reading the next block overlaps counting the
+						last one. Added --pipeline to read a file that way
+						instead of mapping it. Added pipeline.h/.cpp and
+						ring.h, and a streamreader::read() that reads into a
+						buffer the caller owns.
+
+						Text compressed with gzip or zstd is now decompressed
+						as it's read, by the streamreader, with groups of
+						bgzip members or zstd frames decompressed on several
+						threads at once. Added decompressor.h/.cpp, which only
+						compiles in the formats whose libraries are found.
+						Corrupt or cut off data, and read errors, are reported
+						by streamreader::broken(), and then no results are
+						written and the program exits with a failure.
+
+						What a word is made of is now an alphabet picked when
+						the program is compiled, with -DALPHABET: letters (the
+						default), alphanumeric, hyphenated, or utf8. Keys are
+						packed in the radix of the alphabet, so each one
+						keeps every key value for real words, and the default
+						keys haven't changed. The SIMD tokenizer checks only
+						for the characters the alphabet has, and hands chunks
+						with UTF-8 in them to a scalar classifier that looks
+						up letters and lowercase forms in tables made from
+						the Unicode Character Database. Added alphabets.h and
+						unicode.h/.cpp, and tokenizer::lowercase() for words
+						given on the command line. Letters outside of ASCII
+						are case folded with the simple mappings of
+						CaseFolding.txt rather than lowercased, and a report
+						pads words by the columns they take.
+
+						The dictionary now keeps a histogram of how many words
+						have each count, updated by every insert and remove,
+						so dictionary::curve() can print the .csv file in
+						time proportional to the number of different counts,
+						instead of sorting the whole table. Added
+						histogram.h/.cpp, and report::curve() to print a .csv
+						file from it. dictionary::print() prints its .csv file
+						with curve(), and a report can print only its text
+						file.
+
+						Added -n to count the pairs and triples of words in a
+						row along with the words, in one pass, and print them
+						to their own .wrd and .csv files. The dictionary gives
+						each word an id when asked, and an n-gram is kept as
+						the ids of its words. Added ngrams.h/.cpp.
+
+						Added --follow to keep counting a file as it grows,
+						such as a log, reading only what was added to it since
+						it was last checked, and rewriting the results every
+						few seconds. The streamreader can now follow a file,
+						which opens it again when it's truncated or rotated.
+						Each rewrite prints the .csv file from the histogram.
 	@endverbatim
 ******************************************************************************/
 
 
-#include <ctime>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <filesystem>
 #include <iostream>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "decompressor.h"
 #include "dictionary.h"
+#include "mappedfile.h"
+#include "ngrams.h"
+#include "pipeline.h"
+#include "shareddictionary.h"
+#include "sketch.h"
+#include "snapshot.h"
+#include "streamreader.h"
+#include "topk.h"
+
+#include "tokenizer.h"
+
+
+// The number of bytes to tokenize at a time. Small enough that the lowercased
+// copy is still in cache when the words are inserted.
+#define BLOCK_SIZE ( 1 << 16 )
+
+// The number of blocks to look at when picking the size of the keys.
+#define SAMPLE_SLICES 16
+
+// The starting size of the dictionary when reading a stream, which has no file
+// size to go by.
+#define STREAM_DICT_SIZE ( 1 << 16 )
+
+// The number of candidate heavy words a sketch keeps, if -t isn't given.
+#define SKETCH_CANDIDATES 1000
+
+// How many milliseconds to wait between checks for more text in a followed
+// file.
+#define FOLLOW_POLL 250
+
+// What's printed after the name of a file that ended early, because it
+// couldn't be read, or its compressed data was corrupt or cut off.
+#define BROKEN_INPUT " is corrupt, cut off, or couldn't be read, so its results weren't written.\n"
+
+
+// Where logTime() prints to. This is standard error when -p or -r print
+// their words to standard output, so that they can be piped on their own.
+std::ostream * timeLog = &std::cout;
 
 
 /**************************************************************************//**
@@ -170,162 +552,1835 @@ void printUsage()
 "Zipf's Law Program\n"
 "-------------------------------------------------------------------------\n"
 "This program calculates the number of occurences of every word in a given\n"
-"text file. To run this program you must supply the name of a text file.";
+"text file. To run this program you must supply the name of a text file.\n"
+"\n"
+"Usage: <program_name> [options] <text_file>...\n"
+"Use - as the text file to read from standard input. If several files or a\n"
+"directory are given, each file is counted separately. Files compressed\n"
+"with gzip or zstd are decompressed as they're read.\n"
+"\n"
+"Options:\n"
+"  -j <N>    Count words with N threads.\n"
+"  --shared  Count with -j into one dictionary shared by every thread.\n"
+"  --pipeline Read the file on its own thread instead of mapping it.\n"
+"  --follow <S> Keep counting the file as it grows, writing every S seconds.\n"
+"  -k <N>    Use N bit keys, where N is 64 or 128.\n"
+"  -i        Resize the dictionary incrementally.\n"
+#ifdef DICT_STATS
+"  --stats   Write dictionary statistics to <text_file>.json.\n"
+#endif
+"  -o <P>    Write the results to <P>.wrd and <P>.csv.\n"
+"  -a <P>    Also write the totals of every file to <P>.wrd and <P>.csv.\n"
+"  -t <K>    Only count the K most frequent words, in bounded memory.\n"
+"  -c <W>x<D> Count approximately with a W by D Count-Min sketch.\n"
+"  -n <N>    Also count the runs of 2 to N words, where N is 2 or 3.\n"
+"  -p <P>    Print the words starting with P, instead of writing files.\n"
+"  -r <A>:<B> Print the words from A to B, instead of writing files.\n"
+"  --save <F> Save the dictionary to the snapshot file F.\n"
+"  --load <F> Load the snapshot file F, and add the words to it.\n"
+"  --merge   Merge the snapshot files given, instead of counting text.\n"
+"A snapshot can be given instead of a text file, to print or query it.\n";
+}
+
+/*! @struct
+	@brief The options given on the command line. */
+struct options
+{
+	std::vector<const char *> files; //!< The input files and directories, or "-".
+
+	const char * prefix = nullptr; //!< The name of the output files, if given.
+
+	const char * aggregate = nullptr; //!< The name of the totals' output files, if wanted.
+
+	unsigned jobs = 0; //!< The number of threads to count words with, or 0 to pick.
+
+	unsigned keyBits = 0; //!< The size of the dictionary keys, or 0 to pick.
+
+	bool incremental = false; //!< Whether to resize incrementally.
+
+	bool stats = false; //!< Whether to write the dictionary statistics.
+
+	size_t top = 0; //!< The number of words to count with a topk, or 0 to count every word.
+
+	size_t width = 0; //!< The width of the sketch to count with, or 0 to not use one.
+
+	size_t depth = 0; //!< The depth of the sketch to count with.
+
+	unsigned grams = 0; //!< The number of words in the longest n-grams to count, or 0 to only count words.
+
+	char query = 0; //!< 'p' to print the words with a prefix, 'r' to print a range of words, or 0 to write the results files.
+
+	std::string low; //!< The prefix, or the first word of the range.
+
+	std::string high; //!< The last word of the range.
+
+	const char * save = nullptr; //!< The snapshot file to save the dictionary to, if wanted.
+
+	const char * load = nullptr; //!< The snapshot file to start the dictionary from, if given.
+
+	bool merge = false; //!< Whether to merge snapshots instead of counting text.
+
+	bool shared = false; //!< Whether the -j threads count into one shared dictionary.
+
+	bool pipeline = false; //!< Whether to read the file through the pipeline instead of mapping it.
+
+	bool follow = false; //!< Whether to keep counting the file as it grows.
+
+	unsigned refresh = 0; //!< The least number of seconds between rewrites of the results of a followed file.
+};
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function reads the command line options into an 'options' struct.
+
+@param[in] argc - The number of arguments passed to the program.
+@param[in] argv - The arguments passed to the program.
+@param[out] opts - The options read.
+
+@returns bool - True if the options were valid.
+******************************************************************************/
+bool parseOptions( int argc, char * argv[], options & opts )
+{
+	for ( int i = 1; i < argc; ++i )
+	{
+		const std::string_view arg( argv[i] );
+
+		if ( arg == "-j" && i + 1 < argc )
+		{
+			const long jobs = atol( argv[++i] );
+			if ( jobs < 1 ) return false;
+			opts.jobs = unsigned( jobs );
+		}
+
+		else if ( arg == "-k" && i + 1 < argc )
+		{
+			const std::string_view bits( argv[++i] );
+			if ( bits == "64" ) opts.keyBits = 64;
+			#ifdef __SIZEOF_INT128__
+			else if ( bits == "128" ) opts.keyBits = 128;
+			#endif
+			else return false;
+		}
+
+		else if ( arg == "-i" ) opts.incremental = true;
+
+		else if ( arg == "-o" && i + 1 < argc ) opts.prefix = argv[++i];
+
+		else if ( arg == "-a" && i + 1 < argc ) opts.aggregate = argv[++i];
+
+		else if ( arg == "-t" && i + 1 < argc )
+		{
+			const long top = atol( argv[++i] );
+			if ( top < 1 || top > UINT32_MAX ) return false;
+			opts.top = size_t( top );
+		}
+
+		else if ( arg == "-c" && i + 1 < argc )
+		{
+			// The size is given as <width>x<depth>.
+			char * x = nullptr;
+			const unsigned long long width = strtoull( argv[++i], &x, 10 );
+			if ( *x != 'x' ) return false;
+
+			char * rest = nullptr;
+			const unsigned long long depth = strtoull( x + 1, &rest, 10 );
+			if ( *rest || width < 1 || width > UINT32_MAX || depth < 1 || depth > 64 ) return false;
+
+			opts.width = size_t( width );
+			opts.depth = size_t( depth );
+		}
+
+		else if ( arg == "-n" && i + 1 < argc )
+		{
+			const long grams = atol( argv[++i] );
+			if ( grams < 2 || grams > NGRAM_MAX ) return false;
+			opts.grams = unsigned( grams );
+		}
+
+		else if ( arg == "-p" && i + 1 < argc )
+		{
+			opts.query = 'p';
+			opts.low = argv[++i];
+
+			if ( !tokenizer::lowercase( opts.low ) ) return false;
+		}
+
+		else if ( arg == "-r" && i + 1 < argc )
+		{
+			// The range is given as <low>:<high>, where either may be empty.
+			const std::string_view range( argv[++i] );
+			const size_t colon = range.find( ':' );
+			if ( colon == std::string_view::npos ) return false;
+
+			opts.query = 'r';
+			opts.low = range.substr( 0, colon );
+			opts.high = range.substr( colon + 1 );
+
+			if ( !tokenizer::lowercase( opts.low ) || !tokenizer::lowercase( opts.high ) ) return false;
+		}
+
+		else if ( arg == "--save" && i + 1 < argc ) opts.save = argv[++i];
+
+		else if ( arg == "--load" && i + 1 < argc ) opts.load = argv[++i];
+
+		else if ( arg == "--merge" ) opts.merge = true;
+
+		else if ( arg == "--shared" ) opts.shared = true;
+
+		else if ( arg == "--pipeline" ) opts.pipeline = true;
+
+		else if ( arg == "--follow" && i + 1 < argc )
+		{
+			const long refresh = atol( argv[++i] );
+			if ( refresh < 0 || refresh > UINT32_MAX ) return false;
+			opts.follow = true;
+			opts.refresh = unsigned( refresh );
+		}
+
+		#ifdef DICT_STATS
+		else if ( arg == "--stats" ) opts.stats = true;
+		#endif
+
+		// Anything else is an input file.
+		else if ( arg.size() && ( arg[0] != '-' || arg == "-" ) ) opts.files.push_back( argv[i] );
+
+		else return false;
+	}
+
+	if ( opts.files.empty() ) return false;
+
+	// Standard input can't be read along with other files, and -o can only
+	// name the output of one file.
+	for ( const char * file : opts.files )
+		if ( std::string_view( file ) == "-" && opts.files.size() > 1 ) return false;
+
+	if ( opts.prefix && opts.files.size() > 1 && !opts.merge ) return false;
+
+	if ( opts.aggregate && std::string_view( opts.files.front() ) == "-" ) return false;
+
+	// Only the dictionary keeps its words in order, so only it can be queried
+	// or saved.
+	if ( ( opts.query || opts.save || opts.load || opts.merge ) && ( opts.top || opts.width ) ) return false;
+
+	// Merging only reads snapshots, and only makes one result.
+	if ( opts.merge && ( opts.load || opts.aggregate || std::string_view( opts.files.front() ) == "-" ) ) return false;
+
+	// The shared dictionary isn't kept in order, so it can only be printed.
+	if ( opts.shared && ( opts.top || opts.width || opts.query || opts.save || opts.load || opts.merge ) ) return false;
+
+	// N-grams have to be counted in order, and are only printed.
+	if ( opts.grams && ( opts.jobs > 1 || opts.shared || opts.top || opts.width || opts.query || opts.save || opts.load || opts.merge ) ) return false;
+
+	// A followed file is counted on one thread as it's read, and its results
+	// are written over and over.
+	if ( opts.follow && ( opts.jobs > 1 || opts.shared || opts.pipeline || opts.query || opts.merge || std::string_view( opts.files.front() ) == "-" ) ) return false;
+
+	return true;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function makes a new, empty dictionary with the same settings as another
+one, sized for a block of text.
+
+@param[in] dict - The dictionary to copy the settings of.
+@param[in] bytes - The size of the text that will be counted.
+
+@returns dictionary<Key> * - The new dictionary.
+******************************************************************************/
+template <class Key>
+dictionary<Key> * makeLike( const dictionary<Key> & dict, const size_t bytes )
+{
+	dictionary<Key> * const like = new dictionary<Key>( bytes / 120 );
+
+	like->incremental( dict.incremental() );
+
+	return like;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function makes a new, empty topk with as many counters as another one.
+
+@param[in] top - The topk to copy the number of counters of.
+
+@returns topk * - The new topk.
+******************************************************************************/
+topk * makeLike( const topk & top, size_t )
+{
+	return new topk( top.capacity() );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function makes a new, empty sketch with the same size as another one, so
+they can be merged.
+
+@param[in] sk - The sketch to copy the size of.
+
+@returns sketch * - The new sketch.
+******************************************************************************/
+sketch * makeLike( const sketch & sk, size_t )
+{
+	return new sketch( sk.width(), sk.depth(), sk.capacity() );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function inserts a block of words into a dictionary all at once, which
+counts repeated words together and loads their spots ahead of time.
+
+@param[in,out] dict - The dictionary to insert the words into.
+@param[in] block - The words.
+******************************************************************************/
+template <class Key>
+void insertWords( dictionary<Key> & dict, const std::vector<std::string_view> & block )
+{
+	dict.insertBatch( block.data(), block.size() );
+}
+
+/*! @struct
+	@brief One thread's view of a shareddictionary, which inserts into it with
+	the thread's own slot. */
+template <class Key>
+struct sharedslot
+{
+	shareddictionary<Key> & dict; //!< The dictionary.
+
+	unsigned id; //!< The slot of the thread.
+};
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function inserts a block of words into a shared dictionary from one of
+the threads counting into it.
+
+@param[in,out] s - The dictionary, and the slot of the calling thread.
+@param[in] block - The words.
+******************************************************************************/
+template <class Key>
+void insertWords( sharedslot<Key> & s, const std::vector<std::string_view> & block )
+{
+	s.dict.insertBatch( s.id, block.data(), block.size() );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function inserts a block of words into a shared dictionary when only one
+thread is counting, with the first slot.
+
+@param[in,out] dict - The dictionary to insert the words into.
+@param[in] block - The words.
+******************************************************************************/
+template <class Key>
+void insertWords( shareddictionary<Key> & dict, const std::vector<std::string_view> & block )
+{
+	dict.insertBatch( 0, block.data(), block.size() );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function inserts a block of words, and the n-grams they make, into an
+ngrams.
+
+@param[in,out] grams - The ngrams to insert the words into.
+@param[in] block - The words.
+******************************************************************************/
+template <class Key>
+void insertWords( ngrams<Key> & grams, const std::vector<std::string_view> & block )
+{
+	grams.insertBatch( block.data(), block.size() );
 }
 
 /**************************************************************************//**
 @author John Colton
 
 @par Description:
-This function returns the next word from an input stream. A word consists of
-the letters A-z and possibly an apostrophe. The returned string will be in
-lowercase and will not have an apostrophe at the start or end. This function
-will not properly set the streams eofbit, or do any safety checks actually.
+This function inserts a block of words into a topk or sketch, one at a time,
+since their counts depend on the order of the words.
 
-@param[in,out] stream - The input stream being read from.
-@param[in,out] str - The word gotten.
+@param[in,out] dict - The topk or sketch to insert the words into.
+@param[in] block - The words.
+******************************************************************************/
+template <class Counter>
+void insertWords( Counter & dict, const std::vector<std::string_view> & block )
+{
+	for ( const std::string_view word : block ) dict.insert( word );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function counts every word in a block of memory.
 
-@returns bool - True if a word was read.
+@param[in] pos - The start of the block.
+@param[in] end - The end of the block.
+@param[in,out] dict - The dictionary, topk, or sketch to insert the words into.
+
+@returns size_t - The number of words read.
 ******************************************************************************/
-bool getword( std::istream & stream, std::string & str )
+template <class Counter>
+size_t countWords( const char * pos, const char * const end, Counter & dict )
 {
-	// Clear the given string.
-	str.clear();
+	tokenizer tok;
+
+	size_t words = 0; // Number of words read.
+
+	while ( pos != end )
+	{
+		// Get the next block, without splitting a word in two.
+		const char * const next = tokenizer::boundary( end - pos > BLOCK_SIZE ? pos + BLOCK_SIZE : end, end );
+
+		// Get every word from the block and insert it in the dictionary.
+		const std::vector<std::string_view> & block = tok.tokenize( pos, next );
+		insertWords( dict, block );
+
+		words += block.size();
+
+		pos = next;
+	}
 
-	std::streambuf * sb = stream.rdbuf();
+	return words;
+}
+
+/**************************************************************************//**
+@author John Colton
 
-	char c; // temporary variable
+@par Description:
+This function splits a block of text into chunks of about the same size, one
+per thread. A chunk may not end in the middle of a word, so each split is
+moved forward until it's not in a word.
+
+@param[in] begin - The start of the block.
+@param[in] end - The end of the block.
+@param[in] jobs - The number of chunks.
+
+@returns std::vector<const char *> - The start of each chunk, and then 'end'.
+******************************************************************************/
+std::vector<const char *> splitText( const char * const begin, const char * const end, const unsigned jobs )
+{
+	const size_t length = end - begin;
 
-	// While the next character in the stream is not a letter,
-	while ( !isalpha( c = sb->sbumpc() ) )
+	std::vector<const char *> split( jobs + 1, end );
+	split[0] = begin;
+	for ( unsigned i = 1; i < jobs; ++i )
 	{
-		// check that it's not the end of the stream.
-		// If it is, return false.
-		if ( c == EOF ) return false;
+		const char * pos = begin + length / jobs * i;
+
+		if ( pos < split[i-1] ) pos = split[i-1];
+
+		split[i] = tokenizer::boundary( pos, end );
 	}
 
-	// c is a letter at this point, so we can start getting the word.
-	str = tolower( c );
+	return split;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function counts every word in a block of memory using several threads.
+The block is split into one chunk per thread, at word boundaries, and each
+thread counts its chunk into its own dictionary. The dictionaries are then
+merged together in pairs, also in parallel, until only 'dict' is left.
+
+@param[in] begin - The start of the block.
+@param[in] end - The end of the block.
+@param[in] jobs - The number of threads to use.
+@param[in,out] dict - The dictionary, topk, or sketch to insert the words into.
+
+@returns size_t - The number of words read.
+******************************************************************************/
+template <class Counter>
+size_t countWords( const char * const begin, const char * const end, const unsigned jobs, Counter & dict )
+{
+	const std::vector<const char *> split = splitText( begin, end, jobs );
 
-	while ( true )
+	// The first chunk goes into 'dict', and the rest get their own.
+	std::vector<std::unique_ptr<Counter>> owned( jobs );
+	std::vector<Counter *> dicts( jobs, &dict );
+	for ( unsigned i = 1; i < jobs; ++i )
 	{
-		// Get the next character from the stream.
-		c = char( sb->sbumpc() );
+		owned[i].reset( makeLike( dict, split[i+1] - split[i] ) );
+
+		dicts[i] = owned[i].get();
+	}
 
-		// If c is a letter or an apostrophe, add it to the word.
-		if ( isalpha( c ) || c == '\'' ) str += tolower( c );
+	// Count each chunk on its own thread.
+	std::vector<size_t> words( jobs, 0 );
+	std::vector<std::thread> threads;
+	for ( unsigned i = 0; i < jobs; ++i )
+		threads.emplace_back( [&, i]() { words[i] = countWords( split[i], split[i+1], *dicts[i] ); } );
+	for ( std::thread & t : threads ) t.join();
+	threads.clear();
 
-		else break;
+	// Merge the dictionaries in pairs until there is only one left.
+	for ( unsigned step = 1; step < jobs; step <<= 1 )
+	{
+		for ( unsigned i = 0; i + step < jobs; i += step << 1 )
+			threads.emplace_back( [&, i, step]() { dicts[i]->merge( *dicts[i+step] ); } );
+		for ( std::thread & t : threads ) t.join();
+		threads.clear();
 	}
 
-	// Remove trailing apostrophes, if there are any.
-	if ( !str.empty() ) while ( str[str.length() - 1] == '\'' ) str.resize( str.length() - 1 );
+	size_t total = 0;
+	for ( const size_t w : words ) total += w;
 
-	return true;
+	return total;
 }
 
 /**************************************************************************//**
 @author John Colton
 
 @par Description:
-This function prints a message, along with the number of seconds elapsed since
-the program started.
+This function counts every word in a block of memory using several threads,
+all inserting into the same shared dictionary at once, so there is nothing
+to merge at the end.
 
-@param[in] message - The message to print.
+@param[in] begin - The start of the block.
+@param[in] end - The end of the block.
+@param[in] jobs - The number of threads to use. The dictionary must have a
+                  slot for each one.
+@param[in,out] dict - The dictionary to insert the words into.
+
+@returns size_t - The number of words read.
 ******************************************************************************/
-void logTime( const char * const message )
+template <class Key>
+size_t countWords( const char * const begin, const char * const end, const unsigned jobs, shareddictionary<Key> & dict )
 {
-	std::cout.width( 20 );
-	std::cout << std::left << message;
-	std::cout.width( 10 ); std::cout.precision( 5 );
-	std::cout << std::fixed << std::right << clock() / double( CLOCKS_PER_SEC )
-			  << '\n';
+	const std::vector<const char *> split = splitText( begin, end, jobs );
+
+	// Count each chunk on its own thread, with its own slot.
+	std::vector<size_t> words( jobs, 0 );
+	std::vector<std::thread> threads;
+	for ( unsigned i = 0; i < jobs; ++i )
+		threads.emplace_back( [&, i]()
+		{
+			sharedslot<Key> s = { dict, i };
+
+			words[i] = countWords( split[i], split[i+1], s );
+		} );
+	for ( std::thread & t : threads ) t.join();
+
+	size_t total = 0;
+	for ( const size_t w : words ) total += w;
+
+	return total;
 }
 
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function counts every word in a block of memory into an ngrams on one
+thread, since the n-grams that cross from one chunk to the next would be lost
+if it were split. parseOptions() doesn't allow -j with -n.
+
+@param[in] begin - The start of the block.
+@param[in] end - The end of the block.
+@param[in,out] grams - The ngrams to insert the words into.
+
+@returns size_t - The number of words read.
+******************************************************************************/
+template <class Key>
+size_t countWords( const char * const begin, const char * const end, const unsigned, ngrams<Key> & grams )
+{
+	return countWords( begin, end, grams );
+}
 
 /**************************************************************************//**
 @author John Colton
 
 @par Description:
-This is the beginning of the program.
+This function picks the size of key to use for a block of text. A few slices
+spread across the block are tokenized, and if more than 1 in 20 of the words
+are too long to fit in a 64 bit key, 128 bit keys are used, since otherwise
+the dictionary would spend too much time comparing strings.
 
-@param[in] argc - The number of arguments passed to this function.
-@param[in] argv - The arguments passed to this function.
+@param[in] begin - The start of the block.
+@param[in] end - The end of the block.
 
-@returns int - The return code of this program.
+@returns unsigned - The number of bits of key to use.
 ******************************************************************************/
-int main( int argc, char * argv[] )
+unsigned pickKeyBits( const char * const begin, const char * const end )
 {
-	if ( argc != 2 )
+	#ifdef __SIZEOF_INT128__
+	const size_t length = end - begin;
+
+	tokenizer tok;
+
+	size_t words = 0, longer = 0;
+
+	for ( size_t i = 0; i < SAMPLE_SLICES; ++i )
 	{
-		printUsage();
+		const char * const first = tokenizer::boundary( begin + length / SAMPLE_SLICES * i, end );
+		const char * const last = tokenizer::boundary( end - first > BLOCK_SIZE ? first + BLOCK_SIZE : end, end );
 
-		return 0;
+		for ( const std::string_view word : tok.tokenize( first, last ) )
+		{
+			++words;
+
+			longer += ( key64::length( word ) > key64::chars );
+		}
 	}
 
+	if ( 20 * longer > words ) return 128;
+	#endif
 
-	std::cout << "Operation      Seconds Elapsed\n";
-	logTime( "Initializing" );
+	return 64;
+}
 
+/**************************************************************************//**
+@author John Colton
 
-	// Open the input file.
-	std::ifstream fin( argv[1], std::ios_base::in | std::ios_base::binary );
-	if ( !fin )
-	{
-		std::cout << argv[1] << " could not be opened.";
+@par Description:
+This function gets the name of the output files for an input file, which is
+the input file's name without its extension. Only the last part of the path
+is looked at, so a '.' in a directory name is left alone.
 
-		return 0;
-	}
+@param[in] path - The name of the input file.
 
+@returns std::string - The name of the output files, without their extensions.
+******************************************************************************/
+std::string outputName( const std::string & path )
+{
+	const size_t slash = path.find_last_of( "/\\" );
+	const size_t dot = path.find( '.', slash == std::string::npos ? 0 : slash + 1 );
 
-	// Get the input filename as a std::string and remove its file extension.
-	std::string filename( argv[1] );
-	const size_t pLoc = filename.find_first_of( '.' );
-	if ( pLoc != -1 ) filename.resize( pLoc );
+	return path.substr( 0, dot );
+}
 
-	// Get Filesize
-	const size_t filesize = fin.rdbuf()->pubseekoff( 0, std::ios_base::end, std::ios_base::in );
-	fin.rdbuf()->pubseekoff( 0, std::ios_base::beg, std::ios_base::in );
+/**************************************************************************//**
+@author John Colton
 
-	// Initialize dictionary size based on file size.
-	dictionary dict( filesize / 120 );
+@par Description:
+This function lists the files to count. Files are listed as given, and each
+directory is replaced by every regular file in it or in any directory under
+it, in sorted order. Files that look like results of this program (.wrd,
+.csv, .json, and .snap) are skipped, so counting the same directory twice
+gives the same results. A file that was already listed, by any path, isn't
+listed again, so its results aren't written twice at once.
 
-	std::string word; word.reserve( 20 ); // temp variable
+@param[in] inputs - The files and directories given on the command line.
 
-	size_t words = 0; // Number of words read from the input file.
+@returns std::vector<std::string> - The files.
+******************************************************************************/
+std::vector<std::string> listFiles( const std::vector<const char *> & inputs )
+{
+	std::vector<std::string> paths;
+	std::unordered_set<std::string> listed; // The full paths of the files listed so far.
 
+	// Adds a file, unless it was already listed.
+	const auto add = [&]( const std::string & path )
+	{
+		std::error_code error;
+		const std::filesystem::path full = std::filesystem::weakly_canonical( path, error );
 
-	logTime( "Getting Words" );
+		if ( listed.insert( error ? path : full.string() ).second ) paths.push_back( path );
+	};
 
-	// Get every word from the file and insert it in the dictionary.
-	while ( getword( fin, word ) )
+	for ( const char * input : inputs )
 	{
-		dict.insert( word );
+		std::error_code error;
+
+		if ( !std::filesystem::is_directory( input, error ) )
+		{
+			add( input );
+
+			continue;
+		}
+
+		std::vector<std::string> found;
 
-		++words;
+		for ( std::filesystem::recursive_directory_iterator it( input, error ), end; !error && it != end; it.increment( error ) )
+		{
+			if ( !it->is_regular_file( error ) ) continue;
+
+			const std::filesystem::path extension = it->path().extension();
+			if ( extension == ".wrd" || extension == ".csv" || extension == ".json" || extension == ".snap" ) continue;
+
+			found.push_back( it->path().string() );
+		}
+
+		std::sort( found.begin(), found.end() );
+		for ( const std::string & path : found ) add( path );
 	}
 
+	return paths;
+}
+
+/**************************************************************************//**
+@author John Colton
 
-	logTime( "Printing Files" );
+@par Description:
+This function gets the names of the output files for a list of files to count
+at once. Each file's name is its name without its extension, as outputName()
+gives, unless another file's would be the same, or the aggregate's is. Then
+it's the whole name of the file, extension and all.
+
+@param[in] paths - The files, none of them listed twice.
+@param[in] aggregate - The name of the aggregate's output files, or nullptr.
+@param[out] names - The names of the output files of each file, without their
+                    extensions.
+
+@returns bool - False if a file would still write the aggregate's output
+                files, which can only happen if the aggregate's name is a
+                whole file name.
+******************************************************************************/
+bool outputNames( const std::vector<std::string> & paths, const char * const aggregate, std::vector<std::string> & names )
+{
+	std::unordered_map<std::string, size_t> uses; // How many files each short name would be used by.
+	if ( aggregate ) ++uses[aggregate];
 
-	// Open output files.
-	std::ofstream wrd( filename + ".wrd" );
-	std::ofstream csv( filename + ".csv" );
-	
-	// Print Headers
-	wrd << "Zipf's Law: word concordance\n"
-		   "----------------------------\n"
-		   "File:         " << argv[1] << "\n"
-		   "Total Words:  " << words << "\n"
-		   "Unique Words: " << dict.size() << "\n\n";
-	csv << "Zipf's Law,rank * freq = const\n\n"
-		   "File," << argv[1] << "\n"
-		   "Total Words," << words << "\n"
-		   "Unique Words," << dict.size() << "\n\n";
+	names.clear();
+	for ( const std::string & path : paths )
+	{
+		names.push_back( outputName( path ) );
+		++uses[names.back()];
+	}
 
-	// Print Words and Frequencies
-	dict.print( wrd, csv );
+	for ( size_t i = 0; i < paths.size(); ++i )
+		if ( uses[names[i]] > 1 ) names[i] = paths[i];
 
+	// The files are all different, so their whole names are too, but one
+	// can be the aggregate's.
+	std::unordered_set<std::string> taken( names.begin(), names.end() );
+	return taken.size() == names.size() && !( aggregate && taken.count( aggregate ) );
+}
 
-	logTime( "Program Complete" );
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function prints a message, along with the number of seconds elapsed since
+the program started. This is wall clock time rather than CPU time, since CPU
+time adds up across threads.
+
+@param[in] message - The message to print.
+******************************************************************************/
+void logTime( const char * const message )
+{
+	static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	std::ostream & log = *timeLog;
+
+	log.width( 20 );
+	log << std::left << message;
+	log.width( 10 ); log.precision( 5 );
+	log << std::fixed << std::right
+		<< std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count()
+		<< '\n';
+}
+
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function prints the headers of the results of a dictionary, snapshot, or
+shared dictionary, which only differ in where their numbers come from.
+
+@param[in,out] wrd - The .wrd file.
+@param[in,out] csv - The .csv file.
+@param[in] source - What the words were read from.
+@param[in] words - The total number of words read.
+@param[in] unique - The number of different words.
+******************************************************************************/
+void printHeaders( std::ostream & wrd, std::ostream & csv, const std::string_view source, const size_t words, const size_t unique )
+{
+	wrd << "Zipf's Law: word concordance\n"
+		   "----------------------------\n"
+		   "File:         " << source << "\n"
+		   "Total Words:  " << words << "\n"
+		   "Unique Words: " << unique << "\n\n";
+	csv << "Zipf's Law,rank * freq = const\n\n"
+		   "File," << source << "\n"
+		   "Total Words," << words << "\n"
+		   "Unique Words," << unique << "\n\n";
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function prints the words in a dictionary to <filename>.wrd and
+<filename>.csv.
+
+@param[in] opts - The command line options.
+@param[in,out] dict - The dictionary of words.
+@param[in] words - The total number of words read.
+@param[in] source - What the words were read from, to print in the headers.
+@param[in] filename - The name of the output files, without their extensions.
+******************************************************************************/
+template <class Key>
+void printFiles( [[maybe_unused]] const options & opts, dictionary<Key> & dict, const size_t words, const std::string_view source, const std::string & filename )
+{
+	// Open output files.
+	std::ofstream wrd( filename + ".wrd" );
+	std::ofstream csv( filename + ".csv" );
+	
+	// Print Headers
+	printHeaders( wrd, csv, source, words, dict.size() );
+
+	// Print Words and Frequencies
+	dict.print( wrd, csv );
+
+	#ifdef DICT_STATS
+	// Print how the dictionary performed.
+	if ( opts.stats )
+	{
+		std::ofstream json( filename + ".json" );
+		dict.stats( json );
+	}
+	#endif
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function prints the words in a shared dictionary to <filename>.wrd and
+<filename>.csv, exactly as they would be printed for a dictionary.
+
+@param[in] dict - The shared dictionary of words.
+@param[in] words - The total number of words read.
+@param[in] source - What the words were read from, to print in the headers.
+@param[in] filename - The name of the output files, without their extensions.
+******************************************************************************/
+template <class Key>
+void printFiles( const options &, const shareddictionary<Key> & dict, const size_t words, const std::string_view source, const std::string & filename )
+{
+	// Open output files.
+	std::ofstream wrd( filename + ".wrd" );
+	std::ofstream csv( filename + ".csv" );
+
+	// Print Headers
+	printHeaders( wrd, csv, source, words, dict.size() );
+
+	// Print Words and Frequencies
+	dict.print( wrd, csv );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function prints the words counted by an ngrams to <filename>.wrd and
+<filename>.csv, like those of a dictionary, and then the n-grams of each
+length N to <filename>.N.wrd and <filename>.N.csv.
+
+@param[in] opts - The command line options.
+@param[in,out] grams - The ngrams of words.
+@param[in] words - The total number of words read.
+@param[in] source - What the words were read from, to print in the headers.
+@param[in] filename - The name of the output files, without their extensions.
+******************************************************************************/
+template <class Key>
+void printFiles( const options & opts, ngrams<Key> & grams, const size_t words, const std::string_view source, const std::string & filename )
+{
+	printFiles( opts, grams.words(), words, source, filename );
+
+	for ( unsigned n = 2; n <= grams.longest(); ++n )
+	{
+		// Open output files.
+		std::ofstream wrd( filename + "." + std::to_string( n ) + ".wrd" );
+		std::ofstream csv( filename + "." + std::to_string( n ) + ".csv" );
+
+		// Print Headers
+		printHeaders( wrd, csv, source, grams.total( n ), grams.size( n ) );
+
+		// Print N-grams and Frequencies
+		grams.print( n, wrd, csv );
+	}
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function prints the words counted by a topk to <filename>.wrd and
+<filename>.csv, along with how far off the counts could be.
+
+@param[in] opts - The command line options.
+@param[in] top - The topk of words.
+@param[in] words - The total number of words read.
+@param[in] source - What the words were read from, to print in the headers.
+@param[in] filename - The name of the output files, without their extensions.
+******************************************************************************/
+void printFiles( const options & opts, const topk & top, const size_t words, const std::string_view source, const std::string & filename )
+{
+	// Open output files.
+	std::ofstream wrd( filename + ".wrd" );
+	std::ofstream csv( filename + ".csv" );
+
+	// Print Headers
+	wrd << "Zipf's Law: word concordance\n"
+		   "----------------------------\n"
+		   "File:         " << source << "\n"
+		   "Total Words:  " << words << "\n"
+		   "Top Words:    " << top.size() << " of at most " << opts.top << "\n"
+		   "Max Error:    " << top.bound() << "\n\n";
+	csv << "Zipf's Law,rank * freq = const\n\n"
+		   "File," << source << "\n"
+		   "Total Words," << words << "\n"
+		   "Top Words," << top.size() << "\n"
+		   "Max Error," << top.bound() << "\n\n";
+
+	// Print Words and Frequencies
+	top.print( wrd, csv );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function prints the candidate heavy words of a sketch to <filename>.wrd
+and <filename>.csv, along with the size of the sketch and how far off the
+counts could be.
+
+@param[in] sk - The sketch of words.
+@param[in] words - The total number of words read.
+@param[in] source - What the words were read from, to print in the headers.
+@param[in] filename - The name of the output files, without their extensions.
+******************************************************************************/
+void printFiles( const options &, const sketch & sk, const size_t words, const std::string_view source, const std::string & filename )
+{
+	// Open output files.
+	std::ofstream wrd( filename + ".wrd" );
+	std::ofstream csv( filename + ".csv" );
+
+	// Print Headers
+	wrd << "Zipf's Law: word concordance\n"
+		   "----------------------------\n"
+		   "File:         " << source << "\n"
+		   "Total Words:  " << words << "\n"
+		   "Top Words:    " << sk.size() << " of at most " << sk.capacity() << "\n"
+		   "Sketch Size:  " << sk.width() << " x " << sk.depth() << "\n"
+		   "Max Error:    " << sk.bound() << " with probability " << sk.confidence() << "\n\n";
+	csv << "Zipf's Law,rank * freq = const\n\n"
+		   "File," << source << "\n"
+		   "Total Words," << words << "\n"
+		   "Top Words," << sk.size() << "\n"
+		   "Sketch Width," << sk.width() << "\n"
+		   "Sketch Depth," << sk.depth() << "\n"
+		   "Max Error," << sk.bound() << "\n"
+		   "Confidence," << sk.confidence() << "\n\n";
+
+	// Print Words and Frequencies
+	sk.print( wrd, csv );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function prints the words in a snapshot to <filename>.wrd and
+<filename>.csv, exactly as they were printed for the dictionary it was saved
+from.
+
+@param[in] snap - The snapshot of words.
+@param[in] source - What the words were read from, to print in the headers.
+@param[in] filename - The name of the output files, without their extensions.
+******************************************************************************/
+template <class Key>
+void printFiles( const options &, const snapshot<Key> & snap, const std::string_view source, const std::string & filename )
+{
+	// Open output files.
+	std::ofstream wrd( filename + ".wrd" );
+	std::ofstream csv( filename + ".csv" );
+
+	// Print Headers
+	printHeaders( wrd, csv, source, snap.total(), snap.size() );
+
+	// Print Words and Frequencies
+	snap.print( wrd, csv );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function prints the words in a dictionary or snapshot that start with
+the -p prefix, or are in the -r range, along with their counts, one per line.
+
+@param[in] opts - The command line options.
+@param[in,out] dict - The dictionary or snapshot of words.
+******************************************************************************/
+template <template <class> class Table, class Key>
+void queryWords( const options & opts, Table<Key> & dict )
+{
+	std::vector<std::pair<std::string_view, size_t>> found;
+
+	if ( opts.query == 'p' ) dict.prefix( opts.low, found );
+	else dict.range( opts.low, opts.high, found );
+
+	for ( const std::pair<std::string_view, size_t> & w : found ) std::cout << w.first << ' ' << w.second << '\n';
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function does nothing, since a topk or sketch doesn't keep its words in
+order. parseOptions() doesn't allow queries with them.
+******************************************************************************/
+template <class Counter>
+void queryWords( const options &, Counter & )
+{
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function does nothing, since a shared dictionary doesn't keep its words
+in order either. parseOptions() doesn't allow queries with --shared.
+******************************************************************************/
+template <class Key>
+void queryWords( const options &, shareddictionary<Key> & )
+{
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function does nothing, since parseOptions() doesn't allow queries with
+-n.
+******************************************************************************/
+template <class Key>
+void queryWords( const options &, ngrams<Key> & )
+{
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function counts the words in a file and prints the results to
+<filename>.wrd and <filename>.csv.
+
+@param[in] opts - The command line options.
+@param[in] fin - The file to count the words in.
+@param[in] filename - The name of the output files, without their extensions.
+@param[in] loaded - The number of words already counted into the dictionary.
+@param[in,out] dict - The dictionary, topk, or sketch to count the words in.
+
+@returns bool - True, since a mapped file is always read to its end.
+******************************************************************************/
+template <class Counter>
+bool countFile( const options & opts, const mappedfile & fin, const std::string & filename, const size_t loaded, Counter & dict )
+{
+	// Get Filesize
+	const size_t filesize = fin.size();
+
+
+	logTime( "Getting Words" );
+
+	const char * const begin = fin.data();
+	const char * const end = begin + filesize;
+
+	// Get every word from the file and insert it in the dictionary.
+	const size_t words = loaded + ( opts.jobs > 1 ? countWords( begin, end, opts.jobs, dict )
+												  : countWords( begin, end, dict ) );
+
+
+	// Print the words that were asked for, or else every word.
+	if ( opts.query )
+	{
+		logTime( "Querying Words" );
+
+		queryWords( opts, dict );
+	}
+	else
+	{
+		logTime( "Printing Files" );
+
+		printFiles( opts, dict, words, opts.files[0], filename );
+	}
+
+	return true;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function counts the words in a stream and prints the results to
+<filename>.wrd and <filename>.csv. The stream is read and tokenized by a
+pipeline on two more threads, while this one only counts, so reading the next
+block never waits for the last one to be counted.
+
+If the stream ends early, because it couldn't be read or its compressed data
+is corrupt or cut off, nothing is printed but an error.
+
+@param[in] opts - The command line options.
+@param[in,out] fin - The stream to count the words in.
+@param[in] first - The start of the first block, which was already read.
+@param[in] last - The end of the first block.
+@param[in] filename - The name of the output files, without their extensions.
+@param[in] loaded - The number of words already counted into the dictionary.
+@param[in,out] dict - The dictionary, topk, or sketch to count the words in.
+
+@returns bool - False if the stream ended early.
+******************************************************************************/
+template <class Counter>
+bool countStream( const options & opts, streamreader & fin, const char * first, const char * last, const std::string & filename, const size_t loaded, Counter & dict )
+{
+	logTime( "Getting Words" );
+
+	size_t words = loaded;
+
+	// Count each piece as soon as it's tokenized.
+	pipeline pipe;
+	pipe.start( fin, first, last );
+
+	while ( const std::vector<std::string_view> * const block = pipe.next() )
+	{
+		insertWords( dict, *block );
+
+		words += block->size();
+	}
+
+	const std::string_view source( std::string_view( opts.files[0] ) == "-" ? "stdin" : opts.files[0] );
+
+	if ( fin.broken() )
+	{
+		std::cerr << source << BROKEN_INPUT;
+
+		return false;
+	}
+
+
+	// Print the words that were asked for, or else every word.
+	if ( opts.query )
+	{
+		logTime( "Querying Words" );
+
+		queryWords( opts, dict );
+	}
+	else
+	{
+		logTime( "Printing Files" );
+
+		printFiles( opts, dict, words, source, filename );
+	}
+
+	return true;
+}
+
+// Set when the program is told to stop following a file.
+volatile std::sig_atomic_t stopFollowing = 0;
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function handles Ctrl-C, or a request to terminate, while a file is being
+followed, by asking followFile() to finish up.
+******************************************************************************/
+void stopFollow( int )
+{
+	stopFollowing = 1;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function counts the words in a file that's still being written to, and
+keeps counting the words added to it, until the program is stopped. The
+results are printed to <filename>.wrd and <filename>.csv once everything
+already in the file is counted, and then again at most every --follow
+seconds, whenever new words were counted. They're printed one last time when
+the program is stopped, unless the file couldn't be read.
+
+@param[in] opts - The command line options.
+@param[in,out] fin - The file to follow, which must be following.
+@param[in] first - The start of the first block, which was already read.
+@param[in] last - The end of the first block.
+@param[in] filename - The name of the output files, without their extensions.
+@param[in] loaded - The number of words already counted into the dictionary.
+@param[in,out] dict - The dictionary, topk, sketch, or ngrams to count the
+                      words in.
+
+@returns bool - False if the file couldn't be read.
+******************************************************************************/
+template <class Counter>
+bool followFile( const options & opts, streamreader & fin, const char * first, const char * last, const std::string & filename, const size_t loaded, Counter & dict )
+{
+	logTime( "Following File" );
+
+	std::signal( SIGINT, stopFollow );
+	std::signal( SIGTERM, stopFollow );
+
+	size_t words = loaded + countWords( first, last, dict );
+	size_t shown = size_t( -1 ); // The number of words when the results were last printed.
+	std::chrono::steady_clock::time_point printed; // When they were last printed.
+
+	while ( !stopFollowing && !fin.broken() )
+	{
+		// Count everything written since the last check.
+		while ( !stopFollowing && fin.read( first, last ) ) words += countWords( first, last, dict );
+
+		const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if ( words != shown && now - printed >= std::chrono::seconds( opts.refresh ) )
+		{
+			printFiles( opts, dict, words, opts.files[0], filename );
+
+			shown = words;
+			printed = now;
+		}
+
+		std::this_thread::sleep_for( std::chrono::milliseconds( FOLLOW_POLL ) );
+	}
+
+	// Count whatever is left, including a last word that may not be
+	// finished.
+	fin.follow( false );
+	while ( fin.read( first, last ) ) words += countWords( first, last, dict );
+
+	if ( fin.broken() )
+	{
+		std::cerr << opts.files[0] << BROKEN_INPUT;
+
+		return false;
+	}
+
+
+	logTime( "Printing Files" );
+
+	printFiles( opts, dict, words, opts.files[0], filename );
+
+	return true;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function prints the results of a snapshot, or the words asked for with
+-p or -r, straight from the mapped file.
+
+@param[in] opts - The command line options.
+@param[in] fin - The snapshot file.
+@param[in] source - What the snapshot was read from, to print in the headers.
+@param[in] filename - The name of the output files, without their extensions.
+******************************************************************************/
+template <class Key>
+void readSnapshot( const options & opts, const mappedfile & fin, const std::string_view source, const std::string & filename )
+{
+	snapshot<Key> snap;
+	if ( !snap.open( fin.data(), fin.size() ) )
+	{
+		std::cout << source << " is not a valid snapshot.\n";
+
+		return;
+	}
+
+	// Print the words that were asked for, or else every word.
+	if ( opts.query )
+	{
+		logTime( "Querying Words" );
+
+		queryWords( opts, snap );
+	}
+	else
+	{
+		logTime( "Printing Files" );
+
+		printFiles( opts, snap, source, filename );
+	}
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function merges snapshots into one, saves it, and then prints its
+results, or the words asked for with -p or -r, from the saved file.
+
+@param[in] opts - The command line options.
+@param[in] files - The mapped snapshot files.
+@param[in] path - The file to save the merged snapshot to.
+@param[in] filename - The name of the output files, without their extensions.
+******************************************************************************/
+template <class Key>
+void mergeSnapshots( const options & opts, const std::vector<mappedfile> & files, const std::string & path, const std::string & filename )
+{
+	std::vector<snapshot<Key>> parts( files.size() );
+	for ( size_t i = 0; i < files.size(); ++i )
+		if ( !parts[i].open( files[i].data(), files[i].size() ) )
+		{
+			std::cout << opts.files[i] << " is not a valid snapshot.\n";
+
+			return;
+		}
+
+
+	logTime( "Merging Snapshots" );
+
+	std::ofstream out( path, std::ios::binary );
+	if ( !snapshot<Key>::merge( parts, out ) )
+	{
+		std::cout << path << " could not be written.\n";
+
+		return;
+	}
+	out.close();
+
+	// Print the results straight from the merged file.
+	mappedfile fin;
+	if ( !fin.open( path ) )
+	{
+		std::cout << path << " could not be opened.\n";
+
+		return;
+	}
+
+	readSnapshot<Key>( opts, fin, std::to_string( files.size() ) + " snapshots", filename );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function counts the words in many files, each on its own, and prints the
+results for each file next to it. The files are counted on a pool of threads,
+each of which takes the next file as soon as it finishes one. Each thread uses
+one dictionary for all of its files, clearing it in between, so its list only
+has to be allocated and grown once.
+
+If an aggregate was asked for, each thread also adds the words of each file to
+a dictionary of its own, and these are merged together at the end.
+
+A compressed file that ends early, because it couldn't be read or its data is
+corrupt or cut off, gets no results, and then neither does the aggregate.
+
+@param[in] opts - The command line options.
+@param[in] paths - The files to count.
+@param[in] names - The name of the output files of each file, without their
+                   extensions.
+
+@returns bool - False if any file ended early.
+******************************************************************************/
+template <class Key>
+bool countFiles( const options & opts, const std::vector<std::string> & paths, const std::vector<std::string> & names )
+{
+	const unsigned jobs = ( opts.jobs ? opts.jobs : std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1 );
+
+	// Each thread's totals, if they're wanted.
+	std::vector<std::unique_ptr<dictionary<Key>>> totals( jobs );
+	if ( opts.aggregate )
+		for ( std::unique_ptr<dictionary<Key>> & total : totals ) total.reset( new dictionary<Key>( STREAM_DICT_SIZE ) );
+
+	std::vector<size_t> words( jobs, 0 );
+
+	std::atomic<size_t> next( 0 ); // The next file to count.
+
+	std::mutex lock; // Keeps error messages from being printed on top of each other.
+
+	bool failed = false; // Whether any file ended early. Only set under 'lock'.
+
+
+	logTime( "Getting Words" );
+
+	std::vector<std::thread> threads;
+	for ( unsigned t = 0; t < jobs; ++t )
+		threads.emplace_back( [&, t]()
+		{
+			dictionary<Key> dict( STREAM_DICT_SIZE );
+			dict.incremental( opts.incremental );
+
+			mappedfile fin;
+			streamreader stream;
+
+			for ( size_t i = next++; i < paths.size(); i = next++ )
+			{
+				size_t n = 0;
+
+				if ( fin.open( paths[i] ) && decompressor::detect( fin.data(), fin.size() ) == decompressor::plain )
+					n = countWords( fin.data(), fin.data() + fin.size(), dict );
+
+				// A compressed file is decompressed a block at a time on
+				// this thread, since the other threads have files of their
+				// own.
+				else
+				{
+					fin.close();
+
+					if ( !stream.open( paths[i] ) )
+					{
+						std::lock_guard<std::mutex> guard( lock );
+						std::cout << paths[i] << " could not be opened, or is compressed in a format this program wasn't built to read.\n";
+
+						continue;
+					}
+
+					const char * first = nullptr, * last = nullptr;
+					while ( stream.read( first, last ) ) n += countWords( first, last, dict );
+
+					const bool broken = stream.broken();
+					stream.close();
+
+					if ( broken )
+					{
+						std::lock_guard<std::mutex> guard( lock );
+						std::cerr << paths[i] << BROKEN_INPUT;
+						failed = true;
+
+						dict.clear();
+
+						continue;
+					}
+				}
+
+				printFiles( opts, dict, n, paths[i], names[i] );
+
+				if ( totals[t] ) dict.addTo( *totals[t] );
+				words[t] += n;
+
+				dict.clear();
+			}
+		} );
+	for ( std::thread & t : threads ) t.join();
+	threads.clear();
+
+	if ( !opts.aggregate || failed ) return !failed;
+
+
+	logTime( "Merging Totals" );
+
+	// Merge the totals in pairs until there is only one left.
+	for ( unsigned step = 1; step < jobs; step <<= 1 )
+	{
+		for ( unsigned i = 0; i + step < jobs; i += step << 1 )
+			threads.emplace_back( [&, i, step]() { totals[i]->merge( *totals[i+step] ); } );
+		for ( std::thread & t : threads ) t.join();
+		threads.clear();
+	}
+
+	size_t total = 0;
+	for ( const size_t w : words ) total += w;
+
+
+	logTime( "Printing Files" );
+
+	printFiles( opts, *totals[0], total, std::to_string( paths.size() ) + " files", opts.aggregate );
+
+	return true;
+}
+
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function makes a dictionary, loads it from the --load snapshot if one
+was given, runs a function with it, and then saves it to the --save snapshot
+if one was given. Nothing is saved if the function fails.
+
+@param[in] opts - The command line options.
+@param[in] spots - The starting size of the dictionary.
+@param[in] run - The function to run, which takes the dictionary and the
+                 number of words that were counted into the snapshot, and
+                 returns false if it failed.
+
+@returns bool - False if the snapshot couldn't be loaded or saved, or the
+                function failed.
+******************************************************************************/
+template <class Key, class Run>
+bool withDictionary( const options & opts, const size_t spots, Run run )
+{
+	dictionary<Key> dict( spots );
+	size_t loaded = 0;
+
+	if ( opts.load )
+	{
+		logTime( "Loading Snapshot" );
+
+		// The words are copied out of the snapshot, so it can be unmapped
+		// right away.
+		mappedfile fin;
+		snapshot<Key> snap;
+		if ( !fin.open( opts.load ) || !snap.open( fin.data(), fin.size() ) )
+		{
+			std::cout << opts.load << " is not a valid snapshot.\n";
+
+			return false;
+		}
+
+		dict.load( snap );
+		loaded = snap.total();
+	}
+
+	dict.incremental( opts.incremental );
+
+	if ( !run( dict, loaded ) ) return false;
+
+	if ( opts.save )
+	{
+		logTime( "Saving Snapshot" );
+
+		std::ofstream out( opts.save, std::ios::binary );
+		if ( !dict.save( out ) )
+		{
+			std::cout << opts.save << " could not be written.\n";
+
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function makes a shared dictionary with a slot for each -j thread, and
+runs a function with it.
+
+@param[in] opts - The command line options.
+@param[in] spots - The starting size of the dictionary.
+@param[in] run - The function to run, which takes the dictionary and the
+                 number of words already counted into it, which is 0.
+
+@returns bool - What the function returned.
+******************************************************************************/
+template <class Key, class Run>
+bool withShared( const options & opts, const size_t spots, Run run )
+{
+	shareddictionary<Key> dict( spots, opts.jobs ? opts.jobs : 1 );
+
+	return run( dict, 0 );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function makes an ngrams that counts the n-grams asked for with -n, and
+runs a function with it.
+
+@param[in] opts - The command line options.
+@param[in] spots - The starting size of the dictionary.
+@param[in] run - The function to run, which takes the ngrams and the number
+                 of words already counted into it, which is 0.
+
+@returns bool - What the function returned.
+******************************************************************************/
+template <class Key, class Run>
+bool withGrams( const options & opts, const size_t spots, Run run )
+{
+	ngrams<Key> grams( spots, opts.grams );
+	grams.words().incremental( opts.incremental );
+
+	return run( grams, 0 );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function makes the word counter asked for on the command line, and runs
+a function with it: a sketch if -c was given, a topk if -t was given, a
+shared dictionary if --shared was given, an ngrams if -n was given, and
+otherwise a dictionary with keys of the given size, loaded from or saved to a
+snapshot if --load or --save was given.
+
+@param[in] opts - The command line options.
+@param[in] keyBits - The size of the dictionary keys.
+@param[in] spots - The starting size of the dictionary.
+@param[in] run - The function to run, which takes the counter and the number
+                 of words already counted into it, and returns false if it
+                 failed.
+
+@returns bool - False if the function, or loading or saving a snapshot,
+                failed.
+******************************************************************************/
+template <class Run>
+bool withCounter( const options & opts, const unsigned keyBits, const size_t spots, Run run )
+{
+	if ( opts.width )
+	{
+		sketch sk( opts.width, opts.depth, opts.top ? opts.top : SKETCH_CANDIDATES );
+
+		return run( sk, 0 );
+	}
+
+	if ( opts.top )
+	{
+		topk top( opts.top );
+
+		return run( top, 0 );
+	}
+
+	if ( opts.shared )
+	{
+		#ifdef __SIZEOF_INT128__
+		if ( keyBits == 128 ) return withShared<key128>( opts, spots, run );
+		#endif
+
+		return withShared<key64>( opts, spots, run );
+	}
+
+	if ( opts.grams )
+	{
+		#ifdef __SIZEOF_INT128__
+		if ( keyBits == 128 ) return withGrams<key128>( opts, spots, run );
+		#endif
+
+		return withGrams<key64>( opts, spots, run );
+	}
+
+	#ifdef __SIZEOF_INT128__
+	if ( keyBits == 128 ) return withDictionary<key128>( opts, spots, run );
+	#endif
+
+	return withDictionary<key64>( opts, spots, run );
+}
+
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This is the beginning of the program.
+
+@param[in] argc - The number of arguments passed to this function.
+@param[in] argv - The arguments passed to this function.
+
+@returns int - The return code of this program.
+******************************************************************************/
+int main( int argc, char * argv[] )
+{
+	options opts;
+	if ( !parseOptions( argc, argv, opts ) )
+	{
+		printUsage();
+
+		return 0;
+	}
+
+
+	if ( opts.query ) timeLog = &std::cerr;
+
+	*timeLog << "Operation      Seconds Elapsed\n";
+	logTime( "Initializing" );
+
+
+	const char * const file = opts.files[0];
+
+	// Snapshots are merged instead of counted.
+	if ( opts.merge )
+	{
+		const std::string filename( opts.prefix ? opts.prefix : "merged" );
+		const std::string path( opts.save ? opts.save : filename + ".snap" );
+
+		// Every snapshot has to have keys of the same size, and none of them
+		// can be written over by the merged one.
+		std::vector<mappedfile> files( opts.files.size() );
+		unsigned keyBits = 0;
+		for ( size_t i = 0; i < files.size(); ++i )
+		{
+			const unsigned bits = ( files[i].open( opts.files[i] ) ? snapshotKeyBits( files[i].data(), files[i].size() ) : 0 );
+			if ( !bits || ( keyBits && bits != keyBits ) )
+			{
+				std::cout << opts.files[i] << " is not a snapshot with keys of the same size as the others.\n";
+
+				return 0;
+			}
+
+			std::error_code error;
+			if ( std::filesystem::equivalent( opts.files[i], path, error ) )
+			{
+				std::cout << path << " is one of the snapshots being merged.\n";
+
+				return 0;
+			}
+
+			keyBits = bits;
+		}
+
+		#ifdef __SIZEOF_INT128__
+		if ( keyBits == 128 ) mergeSnapshots<key128>( opts, files, path, filename );
+		else
+		#endif
+		mergeSnapshots<key64>( opts, files, path, filename );
+
+		logTime( "Program Complete" );
+
+		return 0;
+	}
+
+	const bool piped = ( std::string_view( file ) == "-" );
+
+	// Several files, or a directory, are counted in batch mode.
+	if ( !piped && ( opts.files.size() > 1 || opts.aggregate || std::filesystem::is_directory( file ) ) )
+	{
+		if ( opts.top || opts.width || opts.grams || opts.query || opts.save || opts.load || opts.shared || opts.pipeline || opts.follow )
+		{
+			std::cout << "-t, -c, -n, -p, -r, --save, --load, --shared, --pipeline, and --follow can only be used with one text file.\n";
+
+			return 0;
+		}
+
+		const std::vector<std::string> paths = listFiles( opts.files );
+
+		// No two files can write the same output files, or they'd be
+		// written over each other at once.
+		std::vector<std::string> names;
+		if ( !outputNames( paths, opts.aggregate, names ) )
+		{
+			std::cerr << opts.aggregate << " is the name of the results of one of the files too, so -a needs another name.\n";
+
+			return EXIT_FAILURE;
+		}
+
+		// Pick the size of the dictionary keys from the first file.
+		mappedfile fin;
+		const unsigned keyBits = ( opts.keyBits ? opts.keyBits : paths.size() && fin.open( paths[0] ) && decompressor::detect( fin.data(), fin.size() ) == decompressor::plain ? pickKeyBits( fin.data(), fin.data() + fin.size() ) : 64 );
+		fin.close();
+
+		#ifdef __SIZEOF_INT128__
+		const bool counted = ( keyBits == 128 ? countFiles<key128>( opts, paths, names ) : countFiles<key64>( opts, paths, names ) );
+		#else
+		const bool counted = countFiles<key64>( opts, paths, names );
+		#endif
+
+		logTime( "Program Complete" );
+
+		return ( counted ? 0 : EXIT_FAILURE );
+	}
+
+	// A loaded dictionary has to keep the size of keys it was saved with.
+	if ( opts.load )
+	{
+		mappedfile snap;
+		const unsigned keyBits = ( snap.open( opts.load ) ? snapshotKeyBits( snap.data(), snap.size() ) : 0 );
+		if ( !keyBits || ( opts.keyBits && opts.keyBits != keyBits ) )
+		{
+			std::cout << opts.load << " is not a valid snapshot with keys of that size.\n";
+
+			return 0;
+		}
+
+		opts.keyBits = keyBits;
+	}
+
+	// Get the name of the output files.
+	const std::string filename( opts.prefix ? opts.prefix : piped ? "stdin" : outputName( file ) );
+
+
+	// A followed file is read as it grows, from the start.
+	if ( opts.follow )
+	{
+		streamreader stream;
+		if ( !stream.open( file ) || stream.format() != decompressor::plain )
+		{
+			std::cout << file << " could not be opened, or is compressed, so it can't be followed.\n";
+
+			return 0;
+		}
+
+		stream.follow( true );
+
+		// Read the first block, and pick the size of the keys from it.
+		const char * first = nullptr, * last = nullptr;
+		stream.read( first, last );
+
+		const unsigned keyBits = ( opts.keyBits || opts.top || opts.width ? opts.keyBits : pickKeyBits( first, last ) );
+
+		const bool counted = withCounter( opts, keyBits, STREAM_DICT_SIZE, [&]( auto & dict, const size_t loaded ) { return followFile( opts, stream, first, last, filename, loaded, dict ); } );
+
+		logTime( "Program Complete" );
+
+		return ( counted ? 0 : EXIT_FAILURE );
+	}
+
+	// Map the input file into memory, unless it's to be read through the
+	// pipeline. A compressed file is always read through the pipeline, which
+	// decompresses it as it's read.
+	mappedfile fin;
+	bool counted = true;
+	if ( !piped && !opts.pipeline && fin.open( file ) && decompressor::detect( fin.data(), fin.size() ) == decompressor::plain )
+	{
+		// A snapshot is used where it is, instead of being counted.
+		if ( const unsigned keyBits = snapshotKeyBits( fin.data(), fin.size() ) )
+		{
+			if ( opts.top || opts.width || opts.grams || opts.save || opts.load || opts.shared )
+			{
+				std::cout << "-t, -c, -n, --save, --load, and --shared can't be used with a snapshot.\n";
+
+				return 0;
+			}
+
+			#ifdef __SIZEOF_INT128__
+			if ( keyBits == 128 ) readSnapshot<key128>( opts, fin, file, filename );
+			else
+			#endif
+			readSnapshot<key64>( opts, fin, file, filename );
+
+			logTime( "Program Complete" );
+
+			return 0;
+		}
+
+		// Pick the size of the dictionary keys.
+		const unsigned keyBits = ( opts.keyBits || opts.top || opts.width ? opts.keyBits : pickKeyBits( fin.data(), fin.data() + fin.size() ) );
+
+		// Initialize dictionary size based on file size.
+		counted = withCounter( opts, keyBits, fin.size() / 120, [&]( auto & dict, const size_t loaded ) { return countFile( opts, fin, filename, loaded, dict ); } );
+	}
+
+	// If it can't be mapped, it might be a pipe, so read it as a stream.
+	else
+	{
+		fin.close();
+
+		// Independent members or frames of a compressed file are
+		// decompressed on up to -j threads, or one per CPU.
+		const unsigned cpus = std::thread::hardware_concurrency();
+
+		streamreader stream;
+		if ( !stream.open( file, opts.jobs ? opts.jobs : cpus ? cpus : 1 ) )
+		{
+			std::cout << file << " could not be opened, or is compressed in a format this program wasn't built to read.\n";
+
+			return 0;
+		}
+
+		// Read the first block, and pick the size of the keys from it.
+		const char * first = nullptr, * last = nullptr;
+		stream.read( first, last );
+
+		const unsigned keyBits = ( opts.keyBits || opts.top || opts.width ? opts.keyBits : pickKeyBits( first, last ) );
+
+		// There's no file size to go by, so start small and let the dictionary
+		// grow.
+		counted = withCounter( opts, keyBits, STREAM_DICT_SIZE, [&]( auto & dict, const size_t loaded ) { return countStream( opts, stream, first, last, filename, loaded, dict ); } );
+	}
+
+
+	logTime( "Program Complete" );
+
+	return ( counted ? 0 : EXIT_FAILURE );
 }
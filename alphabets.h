@@ -0,0 +1,230 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the alphabets that words can be made of.
+
+An alphabet says which characters make up a word, how they're lowercased, and
+how they're numbered when a word is packed into a key (see keys.h). The
+tokenizer and the keys are both built for one alphabet, which is picked when
+the program is compiled by defining ALPHABET as one of these:
+  Alphabet       A word is                                      Radix
+  letters        A-z, with apostrophes inside it                32
+  alphanumeric   A-z and 0-9, with apostrophes inside it        38
+  hyphenated     A-z, with apostrophes and hyphens inside it    29
+  utf8           Letters of any script in UTF-8, with           28
+                 apostrophes inside it
+letters is used if ALPHABET isn't defined. Nothing about an alphabet is looked
+up while the program runs: each one is a set of constants, and the tables made
+from them when it's compiled.
+
+The characters of a word are numbered in alphabetical order starting at 1, so
+that 0 can mark the end of a word, and the radix of a key is how many numbers
+there are. Every value of a key is then a word that could be found, which
+keeps the keys of a text spread out. letters uses a radix of 32 instead of 28
+so that its keys keep the 5 bit fields they have always had.
+
+Unicode has far too many letters to number them all, so the utf8 alphabet
+numbers every letter outside of ASCII as one of a to z, picked from its code
+point. A word in Greek or Chinese gets a key that is as spread out as that of
+a word in English, which matters because the dictionary places a word by its
+key, but the key may be shared with other words. Keys like that are marked as
+lossy, so the dictionary compares their strings, and since they aren't in
+alphabetical order, the words printed with the same count, and the words
+looked at by a range query, are sorted by their strings instead.
+******************************************************************************/
+
+#ifndef ALPHABETS_H
+#define ALPHABETS_H
+
+#include <cstddef>
+#include <string_view>
+#include "unicode.h"
+
+
+/*! @struct
+	@brief What an alphabet says about every byte. */
+struct bytetable
+{
+	//! What a byte can be in a word.
+	enum kind { other, letter, inner };
+
+	unsigned char kind[256]; //!< What each byte is. An inner byte can't start or end a word.
+
+	char lower[256]; //!< Each byte, lowercased.
+
+	unsigned char code[256]; //!< The number of each byte in a key, or 0.
+};
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function makes the table of an ASCII alphabet when the program is
+compiled. Letters are always part of it, apostrophes may be inside a word, and
+the rest depends on the alphabet. Bytes over 127 are never part of it.
+
+@param[in] digits - True if 0-9 are letters.
+@param[in] hyphens - True if hyphens may be inside a word.
+
+@returns bytetable - The table.
+******************************************************************************/
+constexpr bytetable makeTable( const bool digits, const bool hyphens )
+{
+	bytetable t = {};
+	unsigned next = 1;
+
+	// Number the characters in the order of their bytes, so words are
+	// numbered in alphabetical order.
+	for ( unsigned c = 0; c < 256; ++c )
+	{
+		const bool alpha = ( c >= 'a' && c <= 'z' ) || ( digits && c >= '0' && c <= '9' );
+		const bool inside = c == '\'' || ( hyphens && c == '-' );
+
+		t.lower[c] = char( c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c );
+		t.kind[c] = ( alpha || ( c >= 'A' && c <= 'Z' ) ? bytetable::letter : inside ? bytetable::inner : bytetable::other );
+
+		if ( alpha || inside ) t.code[c] = static_cast<unsigned char>( next++ );
+	}
+
+	return t;
+}
+
+
+/*! @struct
+	@brief The 'basicalphabet' struct definition. The alphabets below are
+	all made from this. */
+template <bool Digits, bool Hyphens, bool Unicode>
+struct basicalphabet
+{
+	static const bool digits = Digits; //!< True if 0-9 are letters.
+
+	static const bool hyphens = Hyphens; //!< True if hyphens may be inside a word.
+
+	static const bool unicode = Unicode; //!< True if bytes over 127 are read as UTF-8.
+
+	//! Set in every snapshot, since keys only mean anything in the alphabet
+	//! they were packed in.
+	static const unsigned id = Digits | Hyphens << 1 | Unicode << 2;
+
+	//! The number of the first character that can start a word. The ones
+	//! before it can only be inside a word.
+	static const unsigned base = 2 + Hyphens;
+
+	//! The number of characters that can start a word.
+	static const unsigned firsts = 26 + 10 * Digits;
+
+	//! The radix of a key.
+	static const unsigned radix = ( Digits || Hyphens || Unicode ? base + firsts : 32 );
+
+	//! True if different words can have the same numbers.
+	static const bool lossy = Unicode;
+
+	//! The table of every byte.
+	static constexpr bytetable table = makeTable( Digits, Hyphens );
+
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function reads the next character of a lowercased word and returns
+	its number.
+
+	@param[in,out] pos - The character, moved past it.
+	@param[in] end - The end of the word.
+	@param[in,out] folded - Set to true if the character shares its number
+	                        with other characters.
+
+	@returns unsigned - The number of the character.
+	**************************************************************************/
+	static unsigned symbol( const char * & pos, const char * const end, bool & folded )
+	{
+		const unsigned char c = *pos;
+
+		if ( Unicode && c >= 0x80 )
+		{
+			folded = true;
+
+			return base + utf8Decode( pos, end ) % 26;
+		}
+
+		++pos;
+
+		return table.code[c];
+	}
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function counts the characters in a word.
+
+	@param[in] str - The word.
+
+	@returns size_t - The number of characters, which is the number of bytes
+	                  unless the word is in UTF-8.
+	**************************************************************************/
+	static size_t length( const std::string_view str )
+	{
+		if ( !Unicode ) return str.size();
+
+		// Count every byte that isn't the continuation of a character.
+		size_t n = 0;
+		for ( const char c : str ) n += ( ( c & 0xC0 ) != 0x80 );
+
+		return n;
+	}
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function counts the columns a word takes when it's printed, so
+	that words can be lined up. In UTF-8, a combining mark takes none, and
+	a wide letter, such as a Chinese character, takes two.
+
+	@param[in] str - The word.
+
+	@returns size_t - The number of columns, which is the number of bytes
+	                  unless the word is in UTF-8.
+	**************************************************************************/
+	static size_t columns( const std::string_view str )
+	{
+		if ( !Unicode ) return str.size();
+
+		size_t n = 0;
+		for ( const char * pos = str.data(), * const end = pos + str.size(); pos < end; )
+		{
+			if ( static_cast<unsigned char>( *pos ) < 0x80 )
+			{
+				++pos;
+				++n;
+
+				continue;
+			}
+
+			const uint32_t cp = utf8Decode( pos, end );
+			n += ( cp == UTF8_INVALID ? 1 : unicodeWidth( cp ) );
+		}
+
+		return n;
+	}
+};
+
+
+typedef basicalphabet<false, false, false> letters; //!< A-z.
+
+typedef basicalphabet<true, false, false> alphanumeric; //!< A-z and 0-9.
+
+typedef basicalphabet<false, true, false> hyphenated; //!< A-z, with hyphens inside words.
+
+typedef basicalphabet<false, false, true> utf8; //!< Letters of any script.
+
+
+#ifndef ALPHABET
+	#define ALPHABET letters
+#endif
+
+typedef ALPHABET alphabet; //!< The alphabet the program is compiled for.
+
+
+#endif /* ALPHABETS_H */
@@ -0,0 +1,63 @@
+#include "arena.h"
+
+
+arena::~arena()
+{
+	release();
+}
+
+
+void arena::release()
+{
+	for ( char * block : blocks ) delete[] block;
+
+	blocks.clear();
+
+	pos = end = nullptr;
+
+	held = 0;
+}
+
+void arena::adopt( arena & other )
+{
+	blocks.insert( blocks.end(), other.blocks.begin(), other.blocks.end() );
+
+	held += other.held;
+
+	// Keep allocating from whichever block has more room left.
+	if ( other.end - other.pos > end - pos )
+	{
+		pos = other.pos;
+		end = other.end;
+	}
+
+	other.blocks.clear();
+
+	other.pos = other.end = nullptr;
+
+	other.held = 0;
+}
+
+
+void * arena::grow( const size_t bytes, const size_t align )
+{
+	// Allocations bigger than a block get a block of their own.
+	const size_t size = ( bytes + align > blockSize ? bytes + align : blockSize );
+
+	char * const block = new char[size];
+
+	blocks.push_back( block );
+
+	held += size;
+
+	char * const p = reinterpret_cast<char *>( ( uintptr_t( block ) + align - 1 ) & ~uintptr_t( align - 1 ) );
+
+	// Only switch to the new block if it has more room left than the old one.
+	if ( !pos || block + size - ( p + bytes ) > end - pos )
+	{
+		pos = p + bytes;
+		end = block + size;
+	}
+
+	return p;
+}
@@ -0,0 +1,128 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the arena class.
+
+An arena hands out memory from large blocks by bumping a pointer. Memory can't
+be freed one allocation at a time; instead, all of it is freed at once when the
+arena is released or destroyed. This makes allocation nearly free, and keeps
+things that were allocated together next to each other in memory.
+******************************************************************************/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/*! @class
+	@brief The 'arena' class declaration. */
+class arena
+{
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes the arena. No memory is allocated until it is
+	needed.
+
+	@param[in] size - The size of each block to allocate.
+	**************************************************************************/
+	arena( const size_t size = 1 << 20 ) : blockSize( size ) {}
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function frees all of the memory in the arena.
+	**************************************************************************/
+	~arena();
+
+	arena( const arena & ) = delete;
+	arena & operator = ( const arena & ) = delete;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function allocates memory from the arena.
+
+	@param[in] bytes - The number of bytes to allocate.
+	@param[in] align - The alignment of the memory. Must be a power of 2.
+
+	@returns void * - The memory allocated.
+	**************************************************************************/
+	void * allocate( const size_t bytes, const size_t align = alignof( std::max_align_t ) )
+	{
+		char * const p = reinterpret_cast<char *>( ( uintptr_t( pos ) + align - 1 ) & ~uintptr_t( align - 1 ) );
+
+		// If there isn't enough room left in this block, get a new one.
+		if ( !pos || p + bytes > end ) return grow( bytes, align );
+
+		pos = p + bytes;
+
+		return p;
+	}
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function frees all of the memory in the arena.
+	**************************************************************************/
+	void release();
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function takes all of the memory from another arena, so that it is
+	freed along with this arena's memory. The other arena is left empty.
+
+	@param[in,out] other - The arena to take the memory from.
+	**************************************************************************/
+	void adopt( arena & other );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of bytes of memory held by the arena.
+
+	@returns size_t - The number of bytes held.
+	**************************************************************************/
+	size_t capacity() const { return held; }
+
+
+	private:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function allocates a new block and allocates memory from it.
+
+	@param[in] bytes - The number of bytes to allocate.
+	@param[in] align - The alignment of the memory.
+
+	@returns void * - The memory allocated.
+	**************************************************************************/
+	void * grow( const size_t bytes, const size_t align );
+
+
+	std::vector<char *> blocks; //!< Every block allocated.
+
+	char * pos = nullptr; //!< The next free byte in the current block.
+
+	char * end = nullptr; //!< The end of the current block.
+
+	size_t blockSize; //!< The size of each block.
+
+	size_t held = 0; //!< The total size of every block.
+};
+
+
+#endif /* ARENA_H */
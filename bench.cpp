@@ -0,0 +1,548 @@
+/**************************************************************************//**
+@file
+
+@brief This file contains the dictionary benchmark program.
+
+@author John Colton
+
+@details This program measures the throughput and latency of the dictionary
+		 operations for every key type, resizing mode, table size, load factor,
+		 and find hit ratio, and writes the results as CSV or JSON.
+
+		 The words are random strings of 1 to 16 letters, with the occasional
+		 apostrophe, so both short keys and cut off keys are measured. Every
+		 configuration uses the same words, generated from a fixed seed.
+
+		 Each configuration is run the given number of times with the clock
+		 read only at the start and end of each operation's loop, and the
+		 fastest run gives the throughput. One more run then times every call
+		 on its own for the latency percentiles, less the time it takes to
+		 read the clock. A call to insertBatch() or findBatch() is one sample,
+		 divided by the words it was given. The number of samples is written
+		 with the percentiles.
+		   Op        Measures
+		   hash      Key::pack() on each word.
+		   insert    insert() of each word into a dictionary big enough to
+		             hold them all.
+		   resize    insert() of each word into a dictionary that starts with
+		             1 spot, so the time includes every resize.
+		   find      find() of words, 'hit' of which are in the dictionary.
+		   batch     insertBatch() of BATCH_OPS words at a time into a
+		             dictionary big enough to hold them all.
+		   findbatch findBatch() of the same words as find, BATCH_OPS at a
+		             time.
+		   remove    remove() of every copy of each word.
+		   print     print() of the whole dictionary to a discarding stream.
+		   curve     curve() of the whole dictionary to a discarding stream.
+
+@par Compiling Instructions:
+	GCC:
+		g++ -march=native -O3 -std=gnu++17 -pthread arena.cpp dictionary.cpp histogram.cpp report.cpp snapshot.cpp unicode.cpp bench.cpp -o bench
+
+@par Usage: bench [options]
+	@verbatim
+	-s <N>    The biggest table size to measure. Sizes go up by a factor of
+	          10 from 1000. Defaults to 1000000.
+	-r <N>    Run every configuration N times and keep the fastest run,
+	          then once more to time each call. Defaults to 3.
+	-o <F>    Write the results to file F instead of standard output.
+	--json    Write the results as JSON instead of CSV.
+	@endverbatim
+******************************************************************************/
+
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include "dictionary.h"
+
+
+// The number of words given to insertBatch() and findBatch() at a time.
+#define BATCH_OPS 64
+
+// The number of times to read the clock to find how long reading it takes.
+#define CLOCK_READS 1000
+
+
+/*! @struct
+	@brief The command line options. */
+struct options
+{
+	size_t maxSize = 1000000; //!< The biggest table size to measure.
+
+	unsigned runs = 3; //!< The number of times to run each configuration.
+
+	const char * out = nullptr; //!< The output file, or nullptr for stdout.
+
+	bool json = false; //!< Whether to write JSON instead of CSV.
+};
+
+/*! @struct
+	@brief One configuration being measured. */
+struct config
+{
+	unsigned keyBits; //!< The size of the dictionary keys.
+
+	bool incremental; //!< Whether the dictionary resizes incrementally.
+
+	size_t size; //!< The starting capacity of the dictionary.
+
+	double load; //!< The fraction of the capacity filled with words.
+
+	double hit; //!< The fraction of finds that hit, or -1 if not a find.
+};
+
+/*! @struct
+	@brief The measurements of one operation in one configuration. */
+struct result
+{
+	config conf; //!< The configuration.
+
+	const char * op; //!< The name of the operation.
+
+	size_t ops = 0; //!< The number of operations.
+
+	double seconds = 0; //!< The total time taken.
+
+	size_t samples = 0; //!< The number of calls timed for the percentiles.
+
+	double pct[4] = { 0, 0, 0, 0 }; //!< The 50th, 90th, 99th and 99.9th percentile ns per op.
+
+	double max = 0; //!< The slowest ns per op.
+};
+
+/*! @class
+	@brief A stream buffer that throws away everything written to it. */
+class nullbuf : public std::streambuf
+{
+	protected:
+
+	int overflow( int c ) override { return c; }
+
+	std::streamsize xsputn( const char *, std::streamsize n ) override { return n; }
+};
+
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function prints how to use this program.
+******************************************************************************/
+void printUsage()
+{
+	std::cout <<
+"Dictionary Benchmark\n"
+"-------------------------------------------------------------------------\n"
+"Usage: bench [options]\n"
+"\n"
+"Options:\n"
+"  -s <N>    The biggest table size to measure.\n"
+"  -r <N>    Keep the fastest of N runs.\n"
+"  -o <F>    Write the results to file F.\n"
+"  --json    Write JSON instead of CSV.\n";
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function reads the command line options into an 'options' struct.
+
+@param[in] argc - The number of arguments passed to the program.
+@param[in] argv - The arguments passed to the program.
+@param[out] opts - The options read.
+
+@returns bool - True if the options were valid.
+******************************************************************************/
+bool parseOptions( int argc, char * argv[], options & opts )
+{
+	for ( int i = 1; i < argc; ++i )
+	{
+		const std::string_view arg( argv[i] );
+
+		if ( arg == "-s" && i + 1 < argc )
+		{
+			const long size = atol( argv[++i] );
+			if ( size < 1000 ) return false;
+			opts.maxSize = size_t( size );
+		}
+
+		else if ( arg == "-r" && i + 1 < argc )
+		{
+			const long runs = atol( argv[++i] );
+			if ( runs < 1 ) return false;
+			opts.runs = unsigned( runs );
+		}
+
+		else if ( arg == "-o" && i + 1 < argc ) opts.out = argv[++i];
+
+		else if ( arg == "--json" ) opts.json = true;
+
+		else return false;
+	}
+
+	return true;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function generates unique random words. Words are 1 to 16 characters
+long, so some of them are too long to fit in a 64 bit key.
+
+@param[in] count - The number of words to generate.
+@param[in,out] rng - The random number generator.
+@param[in,out] seen - Words already generated, which won't be generated again.
+
+@returns std::vector<std::string> - The words.
+******************************************************************************/
+std::vector<std::string> makeWords( const size_t count, std::mt19937_64 & rng, std::unordered_set<std::string> & seen )
+{
+	std::vector<std::string> words;
+	words.reserve( count );
+
+	while ( words.size() < count )
+	{
+		std::string str( 1 + rng() % 16, 'a' );
+
+		for ( size_t i = 0; i < str.size(); ++i )
+			str[i] = ( i && i + 1 < str.size() && rng() % 20 == 0 ? '\'' : char( 'a' + rng() % 26 ) );
+
+		if ( seen.insert( str ).second ) words.push_back( std::move( str ) );
+	}
+
+	return words;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function finds the fewest nanoseconds between two reads of the clock.
+
+@returns double - The time it takes to read the clock, in nanoseconds.
+******************************************************************************/
+double clockOverhead()
+{
+	double fastest = 1e9;
+
+	for ( int i = 0; i < CLOCK_READS; ++i )
+	{
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+		fastest = std::min( fastest, std::chrono::duration<double, std::nano>( end - start ).count() );
+	}
+
+	return fastest;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function runs an operation on every item in a list, 'step' items at a
+time, and adds the results to 'res'.
+
+Without 'latency', only the whole loop is timed, and if it was faster than any
+run before it, its time replaces theirs. With 'latency', every call is timed on
+its own, less the time it takes to read the clock, and the percentiles of the
+time per item replace those before.
+
+@param[in] count - The number of items.
+@param[in] step - The number of items each call of 'op' handles.
+@param[in] op - The operation, which takes the index of its first item.
+@param[in,out] res - The results.
+@param[in] latency - Whether to time each call instead of the whole loop.
+******************************************************************************/
+template <class Op>
+void timeOps( const size_t count, const size_t step, Op op, result & res, const bool latency )
+{
+	if ( !latency )
+	{
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		for ( size_t i = 0; i < count; i += step ) op( i );
+
+		const double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+		// Keep the fastest run.
+		if ( res.ops && seconds >= res.seconds ) return;
+
+		res.ops = count;
+		res.seconds = seconds;
+
+		return;
+	}
+
+	static const double overhead = clockOverhead();
+
+	std::vector<double> samples;
+	samples.reserve( count / step + 1 );
+
+	for ( size_t i = 0; i < count; i += step )
+	{
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		op( i );
+		const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+		const double ns = std::chrono::duration<double, std::nano>( end - start ).count() - overhead;
+		samples.push_back( std::max( ns, 0.0 ) / std::min( step, count - i ) );
+	}
+
+	res.samples = samples.size();
+
+	if ( samples.empty() ) return;
+
+	std::sort( samples.begin(), samples.end() );
+
+	const double fractions[4] = { 0.5, 0.9, 0.99, 0.999 };
+	for ( int i = 0; i < 4; ++i )
+		res.pct[i] = samples[size_t( fractions[i] * ( samples.size() - 1 ) )];
+
+	res.max = samples.back();
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function measures every operation on a dictionary with one key type, for
+one table size, load factor and resizing mode.
+
+@param[in] conf - The configuration. Its hit ratio is ignored.
+@param[in] hits - Words to put in the dictionary.
+@param[in] misses - Words that are never put in the dictionary.
+@param[in] runs - The number of times to run each operation for throughput.
+@param[in,out] results - Where to add the results.
+******************************************************************************/
+template <class Key>
+void benchConfig( config conf, const std::vector<std::string> & hits, const std::vector<std::string> & misses,
+				  const unsigned runs, std::vector<result> & results )
+{
+	const size_t count = size_t( conf.size * conf.load );
+	const double ratios[4] = { 0, 0.5, 0.9, 1 };
+
+	conf.hit = -1;
+
+	result hash{ conf, "hash" }, insert{ conf, "insert" }, resize{ conf, "resize" }, batch{ conf, "batch" }, remove{ conf, "remove" }, print{ conf, "print" }, curve{ conf, "curve" };
+	std::vector<result> find, findBatch;
+	for ( double ratio : ratios )
+	{
+		config c = conf; c.hit = ratio;
+		find.push_back( result{ c, "find" } );
+		findBatch.push_back( result{ c, "findbatch" } );
+	}
+
+	// The finds use the same shuffled mix of hits and misses every run.
+	std::vector<std::vector<const std::string *>> lookups( 4 );
+	std::mt19937_64 rng( conf.size );
+	for ( int r = 0; r < 4; ++r )
+	{
+		for ( size_t i = 0; i < count; ++i )
+			lookups[r].push_back( rng() % 1000 < ratios[r] * 1000 ? &hits[rng() % count] : &misses[rng() % misses.size()] );
+	}
+
+	// The batched operations take views of the words.
+	std::vector<std::string_view> words( hits.begin(), hits.begin() + count );
+	std::vector<std::vector<std::string_view>> views( 4 );
+	for ( int r = 0; r < 4; ++r )
+		for ( const std::string * str : lookups[r] ) views[r].push_back( *str );
+	std::vector<size_t> counts( BATCH_OPS );
+
+	nullbuf discard;
+	std::ostream txt( &discard ), csv( &discard );
+
+	volatile uint64_t sink = 0;
+
+	// The last run times each call on its own for the latency percentiles.
+	for ( unsigned run = 0; run <= runs; ++run )
+	{
+		const bool latency = ( run == runs );
+
+		timeOps( count, 1, [&]( size_t i ) { sink = sink + uint64_t( Key::pack( hits[i] ) ); }, hash, latency );
+
+		{
+			dictionary<Key> grow( 1 );
+			grow.incremental( conf.incremental );
+
+			timeOps( count, 1, [&]( size_t i ) { grow.insert( hits[i] ); }, resize, latency );
+		}
+
+		dictionary<Key> dict( conf.size );
+		dict.incremental( conf.incremental );
+
+		timeOps( count, 1, [&]( size_t i ) { dict.insert( hits[i] ); }, insert, latency );
+
+		for ( int r = 0; r < 4; ++r )
+			timeOps( count, 1, [&]( size_t i ) { sink = sink + dict.find( *lookups[r][i] ); }, find[r], latency );
+
+		for ( int r = 0; r < 4; ++r )
+			timeOps( count, BATCH_OPS, [&]( size_t i )
+			{
+				dict.findBatch( &views[r][i], std::min<size_t>( BATCH_OPS, count - i ), counts.data() );
+				sink = sink + counts[0];
+			}, findBatch[r], latency );
+
+		{
+			dictionary<Key> batched( conf.size );
+			batched.incremental( conf.incremental );
+
+			timeOps( count, BATCH_OPS, [&]( size_t i ) { batched.insertBatch( &words[i], std::min<size_t>( BATCH_OPS, count - i ) ); }, batch, latency );
+		}
+
+		timeOps( 1, 1, [&]( size_t ) { dict.print( txt, csv ); }, print, latency );
+
+		timeOps( 1, 1, [&]( size_t ) { dict.curve( csv ); }, curve, latency );
+
+		timeOps( count, 1, [&]( size_t i ) { dict.remove( hits[i] ); }, remove, latency );
+	}
+
+	results.push_back( hash );
+	results.push_back( insert );
+	results.push_back( resize );
+	results.push_back( batch );
+	results.insert( results.end(), find.begin(), find.end() );
+	results.insert( results.end(), findBatch.begin(), findBatch.end() );
+	results.push_back( remove );
+	results.push_back( print );
+	results.push_back( curve );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function writes the results as CSV, with a header row.
+
+@param[in,out] out - The stream to write to.
+@param[in] results - The results.
+******************************************************************************/
+void writeCSV( std::ostream & out, const std::vector<result> & results )
+{
+	out << "key,mode,size,load,hit,op,ops,seconds,mops,samples,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n";
+
+	for ( const result & r : results )
+	{
+		out << r.conf.keyBits << ',' << ( r.conf.incremental ? "incremental" : "normal" ) << ','
+			<< r.conf.size << ',' << r.conf.load << ',';
+
+		if ( r.conf.hit >= 0 ) out << r.conf.hit;
+
+		out << ',' << r.op << ',' << r.ops << ',' << r.seconds << ',' << ( r.seconds > 0 ? r.ops / r.seconds / 1e6 : 0 ) << ',' << r.samples;
+
+		for ( double p : r.pct ) out << ',' << p;
+
+		out << ',' << r.max << '\n';
+	}
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function writes the results as a JSON array of objects, one per result.
+
+@param[in,out] out - The stream to write to.
+@param[in] results - The results.
+******************************************************************************/
+void writeJSON( std::ostream & out, const std::vector<result> & results )
+{
+	out << "[\n";
+
+	for ( size_t i = 0; i < results.size(); ++i )
+	{
+		const result & r = results[i];
+
+		out << "  {\"key\": " << r.conf.keyBits
+			<< ", \"mode\": \"" << ( r.conf.incremental ? "incremental" : "normal" ) << '"'
+			<< ", \"size\": " << r.conf.size << ", \"load\": " << r.conf.load << ", \"hit\": ";
+
+		if ( r.conf.hit >= 0 ) out << r.conf.hit;
+		else out << "null";
+
+		out << ", \"op\": \"" << r.op << "\", \"ops\": " << r.ops << ", \"seconds\": " << r.seconds
+			<< ", \"mops\": " << ( r.seconds > 0 ? r.ops / r.seconds / 1e6 : 0 )
+			<< ", \"samples\": " << r.samples << ", \"p50_ns\": " << r.pct[0] << ", \"p90_ns\": " << r.pct[1]
+			<< ", \"p99_ns\": " << r.pct[2] << ", \"p999_ns\": " << r.pct[3]
+			<< ", \"max_ns\": " << r.max << '}' << ( i + 1 < results.size() ? "," : "" ) << '\n';
+	}
+
+	out << "]\n";
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This is the starting point of the program. It generates the words, runs every
+configuration, and writes the results.
+
+@param[in] argc - The number of arguments passed to the program.
+@param[in] argv - The arguments passed to the program.
+
+@returns int - 0 if successful, 1 if the options were invalid.
+******************************************************************************/
+int main( int argc, char * argv[] )
+{
+	options opts;
+	if ( !parseOptions( argc, argv, opts ) )
+	{
+		printUsage();
+
+		return 1;
+	}
+
+	std::ofstream file;
+	if ( opts.out )
+	{
+		file.open( opts.out );
+		if ( !file )
+		{
+			std::cout << opts.out << " could not be opened.\n";
+
+			return 1;
+		}
+	}
+
+	std::ostream & out = ( opts.out ? file : std::cout );
+
+	const double loads[3] = { 0.25, 0.5, 0.7 };
+
+	// Generate enough words for the biggest table, plus as many that are never
+	// inserted.
+	std::mt19937_64 rng( 12345 );
+	std::unordered_set<std::string> seen;
+	const std::vector<std::string> hits = makeWords( size_t( opts.maxSize * 0.7 ), rng, seen );
+	const std::vector<std::string> misses = makeWords( size_t( opts.maxSize * 0.7 ), rng, seen );
+	seen.clear();
+
+	std::vector<result> results;
+
+	for ( size_t size = 1000; size <= opts.maxSize; size *= 10 )
+		for ( double load : loads )
+			for ( bool incremental : { false, true } )
+			{
+				config conf = { 64, incremental, size, load, -1 };
+				benchConfig<key64>( conf, hits, misses, opts.runs, results );
+
+				#ifdef __SIZEOF_INT128__
+				conf.keyBits = 128;
+				benchConfig<key128>( conf, hits, misses, opts.runs, results );
+				#endif
+			}
+
+	if ( opts.json ) writeJSON( out, results );
+	else writeCSV( out, results );
+
+	return 0;
+}
@@ -0,0 +1,244 @@
+#include <climits>
+#include "decompressor.h"
+
+#if __has_include( <zlib.h> )
+	#include <zlib.h>
+	#define HAVE_ZLIB true
+#else
+	#define HAVE_ZLIB false
+#endif
+
+#if __has_include( <zstd.h> )
+	#include <zstd.h>
+	#define HAVE_ZSTD true
+#else
+	#define HAVE_ZSTD false
+#endif
+
+
+// The bytes every gzip member starts with: its magic number, and deflate.
+#define GZIP_MAGIC "\x1f\x8b\x08"
+
+// The size of a gzip header without its optional fields.
+#define GZIP_HEADER 10
+
+// The flag of a gzip header that says it has an extra field.
+#define GZIP_FEXTRA 4
+
+// The magic number every zstd frame starts with, in little endian order.
+#define ZSTD_FRAME_MAGIC 0xFD2FB528u
+
+// Skippable zstd frames, like the one pzstd starts its files with, have any
+// magic number from this one to this one + 15.
+#define ZSTD_SKIP_MAGIC 0x184D2A50u
+
+
+namespace
+{
+	/*! @brief Reads a little endian number of 'n' bytes. */
+	size_t little( const char * const data, const unsigned n )
+	{
+		size_t value = 0;
+		for ( unsigned i = n; i-- > 0; ) value = ( value << 8 ) | static_cast<unsigned char>( data[i] );
+
+		return value;
+	}
+}
+
+
+decompressor::format decompressor::detect( const char * const data, const size_t size )
+{
+	if ( size >= 3 && data[0] == GZIP_MAGIC[0] && data[1] == GZIP_MAGIC[1] && data[2] == GZIP_MAGIC[2] ) return gzip;
+
+	if ( size >= 4 )
+	{
+		const size_t magic = little( data, 4 );
+
+		if ( magic == ZSTD_FRAME_MAGIC || ( magic & ~size_t( 15 ) ) == ZSTD_SKIP_MAGIC ) return zstd;
+	}
+
+	return plain;
+}
+
+bool decompressor::supported( const format f )
+{
+	return ( f == plain || ( f == gzip && HAVE_ZLIB ) || ( f == zstd && HAVE_ZSTD ) );
+}
+
+size_t decompressor::frame( const format f, const char * const data, const size_t size )
+{
+	if ( f == gzip )
+	{
+		// Only a member with bgzip's "BC" extra field says how big it is. Its
+		// value is the size of the whole member, minus 1.
+		if ( size < GZIP_HEADER + 2 || !( data[3] & GZIP_FEXTRA ) ) return 0;
+
+		const size_t end = GZIP_HEADER + 2 + little( data + GZIP_HEADER, 2 );
+
+		for ( size_t pos = GZIP_HEADER + 2; pos + 4 <= end && end <= size; pos += 4 + little( data + pos + 2, 2 ) )
+		{
+			if ( data[pos] == 'B' && data[pos+1] == 'C' && little( data + pos + 2, 2 ) == 2 && pos + 6 <= end )
+			{
+				const size_t member = little( data + pos + 4, 2 ) + 1;
+
+				return ( member <= size ? member : 0 );
+			}
+		}
+
+		return 0;
+	}
+
+	#if HAVE_ZSTD
+	if ( f == zstd )
+	{
+		// Fails if the frame is cut off, as well as if it's corrupt.
+		const size_t length = ZSTD_findFrameCompressedSize( data, size );
+
+		return ( ZSTD_isError( length ) ? 0 : length );
+	}
+	#endif
+
+	return 0;
+}
+
+
+decompressor::decompressor( const format f ) : type( f )
+{
+	#if HAVE_ZLIB
+	if ( type == gzip )
+	{
+		z_stream * const z = new z_stream();
+
+		// 16 tells zlib to expect a gzip header instead of a zlib one.
+		inflateInit2( z, 15 + 16 );
+
+		state = z;
+	}
+	#endif
+
+	#if HAVE_ZSTD
+	if ( type == zstd )
+	{
+		ZSTD_DStream * const z = ZSTD_createDStream();
+		ZSTD_initDStream( z );
+
+		state = z;
+	}
+	#endif
+}
+
+decompressor::~decompressor()
+{
+	#if HAVE_ZLIB
+	if ( type == gzip )
+	{
+		inflateEnd( static_cast<z_stream *>( state ) );
+		delete static_cast<z_stream *>( state );
+	}
+	#endif
+
+	#if HAVE_ZSTD
+	if ( type == zstd ) ZSTD_freeDStream( static_cast<ZSTD_DStream *>( state ) );
+	#endif
+}
+
+
+decompressor::result decompressor::decode( const char * & in, const char * const inEnd, char * & out, char * const outEnd, const bool last )
+{
+	#if HAVE_ZLIB
+	if ( type == gzip )
+	{
+		z_stream * const z = static_cast<z_stream *>( state );
+
+		while ( out != outEnd )
+		{
+			if ( between )
+			{
+				// Another member may follow. Anything else, such as the 0's
+				// some tools pad files with, is ignored, as gzip does.
+				if ( inEnd - in < 2 && !last ) return more;
+				if ( inEnd - in < 2 || in[0] != GZIP_MAGIC[0] || in[1] != GZIP_MAGIC[1] )
+				{
+					in = inEnd;
+
+					return end;
+				}
+
+				inflateReset( z );
+				between = false;
+			}
+
+			z->next_in = reinterpret_cast<Bytef *>( const_cast<char *>( in ) );
+			z->avail_in = uInt( inEnd - in < UINT_MAX ? inEnd - in : UINT_MAX );
+			z->next_out = reinterpret_cast<Bytef *>( out );
+			z->avail_out = uInt( outEnd - out < UINT_MAX ? outEnd - out : UINT_MAX );
+
+			const int status = inflate( z, Z_NO_FLUSH );
+
+			in = reinterpret_cast<const char *>( z->next_in );
+			out = reinterpret_cast<char *>( z->next_out );
+
+			if ( status == Z_STREAM_END ) between = true;
+
+			// No progress could be made without more input, which is an
+			// error if the input is over.
+			else if ( status == Z_BUF_ERROR ) return ( last ? error : more );
+
+			else if ( status != Z_OK ) return error;
+		}
+
+		return more;
+	}
+	#endif
+
+	#if HAVE_ZSTD
+	if ( type == zstd )
+	{
+		ZSTD_DStream * const z = static_cast<ZSTD_DStream *>( state );
+
+		ZSTD_inBuffer input = { in, size_t( inEnd - in ), 0 };
+		ZSTD_outBuffer output = { out, size_t( outEnd - out ), 0 };
+		result status = more;
+
+		while ( output.pos < output.size )
+		{
+			// The next frame starts on its own, so the data only ends where
+			// the input does.
+			if ( between && input.pos == input.size )
+			{
+				if ( last ) status = end;
+
+				break;
+			}
+
+			const size_t before = input.pos + output.pos;
+			const size_t hint = ZSTD_decompressStream( z, &output, &input );
+
+			if ( ZSTD_isError( hint ) )
+			{
+				status = error;
+
+				break;
+			}
+
+			// 0 means a frame just ended, and all of it was written.
+			between = ( hint == 0 );
+
+			if ( !between && input.pos + output.pos == before )
+			{
+				if ( last ) status = error;
+
+				break;
+			}
+		}
+
+		in += input.pos;
+		out += output.pos;
+
+		return status;
+	}
+	#endif
+
+	// Nothing was compiled in for this format.
+	return error;
+}
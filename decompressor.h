@@ -0,0 +1,132 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the decompressor class.
+
+A decompressor turns gzip or zstd compressed text back into text, a buffer at a
+time, so a compressed file can be counted without decompressing it to disk
+first. Files made of several gzip members or zstd frames one after another,
+such as ones made by cat, pigz, bgzip, or pzstd, are decompressed as one text.
+
+Each format is only compiled in if its library's header is found: zlib.h for
+gzip, which needs -lz, and zstd.h for zstd, which needs -lzstd. Without them,
+the format is still recognized, so it can be reported instead of counted as if
+it were text.
+
+Some files say where each member or frame ends without having to decompress
+it: bgzip writes the size of every member in its header, and every zstd frame
+can be measured from its block headers. Those pieces don't depend on each
+other, so frame() finds them, and streamreader decompresses several at once
+on different threads.
+******************************************************************************/
+
+#ifndef DECOMPRESSOR_H
+#define DECOMPRESSOR_H
+
+#include <cstddef>
+
+
+/*! @class
+	@brief The 'decompressor' class declaration. */
+class decompressor
+{
+	public:
+
+	//! The formats a decompressor recognizes.
+	enum format { plain, gzip, zstd };
+
+	//! What decode() stopped at.
+	enum result { more, end, error };
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds the format of a file from its first few bytes.
+
+	@param[in] data - The start of the file.
+	@param[in] size - The number of bytes of it given, which should be at
+	                  least 4.
+
+	@returns format - The format, or 'plain' if it isn't compressed.
+	**************************************************************************/
+	static format detect( const char * const data, const size_t size );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function checks if a format was compiled in.
+
+	@param[in] f - The format.
+
+	@returns bool - True if it can be decompressed.
+	**************************************************************************/
+	static bool supported( const format f );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds where the first member or frame of compressed data
+	ends, if that can be told without decompressing it.
+
+	@param[in] f - The format of the data.
+	@param[in] data - The start of the member or frame.
+	@param[in] size - The number of bytes available.
+
+	@returns size_t - The size of the member or frame. 0 if it's cut off, or
+	                  if its end can't be found without decompressing it.
+	**************************************************************************/
+	static size_t frame( const format f, const char * const data, const size_t size );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes a decompressor for a format.
+
+	@param[in] f - The format. It must be supported.
+	**************************************************************************/
+	decompressor( const format f );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function frees the library's state.
+	**************************************************************************/
+	~decompressor();
+
+	decompressor( const decompressor & ) = delete;
+	decompressor & operator = ( const decompressor & ) = delete;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function decompresses as much input into as much output as it can.
+	It stops when the input runs out, the output is full, or the data ends.
+	A new member or frame right after one that ended is decompressed too.
+
+	@param[in,out] in - The start of the input, moved past what was used.
+	@param[in] inEnd - The end of the input.
+	@param[in,out] out - The start of the output, moved past what was
+	                     written.
+	@param[in] outEnd - The end of the output.
+	@param[in] last - True if there is no more input after 'inEnd'.
+
+	@returns result - 'end' once the data has ended, 'error' if it's
+	                  corrupt, and otherwise 'more'.
+	**************************************************************************/
+	result decode( const char * & in, const char * const inEnd, char * & out, char * const outEnd, const bool last );
+
+
+	private:
+
+	format type; //!< The format being decompressed.
+
+	void * state = nullptr; //!< The library's stream: a z_stream, or a ZSTD_DStream.
+
+	bool between = false; //!< True right after a member or frame ended.
+};
+
+
+#endif /* DECOMPRESSOR_H */
@@ -1,477 +1,1034 @@
+#include <algorithm>
+#ifdef DICT_STATS
+	#include <chrono>
+#endif
 #include <iostream>
+#include <limits>
+#include <new>
+#include <utility>
 #include <vector>
 #include "dictionary.h"
+#include "report.h"
+#include "snapshot.h"
 
 
-// Just for convenience.
-#define RE_CAST_BIN reinterpret_cast<const BIN&>
+// The spot in table T that key K points to.
+#define HOME( K, T ) size_t( mulhi( Key::top( K ), (T).scale ) )
 
-// For comparing words.
-#define LOC_H_LT_HINT RE_CAST_BIN((*location)->hash) < Hint
-#define LOC_H_IS_HINT RE_CAST_BIN((*location)->hash) == Hint
-#if BLOOMISH
-	#define LOC_STR_LT_STR (*location)->str < str
-	#define LOC_STR_IS_STR (*location)->str == str
+// With DICT_STATS, STAT( X ) runs X, and COUNT_COMPARE counts a string
+// compare. Without it, both are nothing.
+#ifdef DICT_STATS
+	#define STAT( X ) X
+	#define COUNT_COMPARE ++info.compares,
 #else
-	#define LOC_STR_LT_STR true
-	#define LOC_STR_IS_STR true
+	#define STAT( X )
+	#define COUNT_COMPARE
 #endif
 
-// Overloaded std::string compare so it works the way I want.
-inline bool operator < ( const std::string & lhs, const std::string & rhs)
-{
-	// Get the length of the shorter of the two strings.
-	const size_t length = ( lhs.length() < rhs.length() ? lhs.length() : rhs.length() );
+// For comparing words in table T. A string only has to be compared if the key
+// may have been cut off, since otherwise the key is the whole word.
+#define LOC_STR_LT_STR( T ) ( Key::truncated( K ) && ( COUNT_COMPARE (T).words[i]->str() < str ) )
+#define LOC_STR_IS_STR( T ) ( !Key::truncated( K ) || ( COUNT_COMPARE (T).words[i]->str() == str ) )
 
-	// Compare the strings up to that length.
-	for ( size_t i = 0; i < length; ++i )
-	{
-		if ( lhs[i] < rhs[i] ) return true;
+// True if spot 'i' of table T holds the word 'str' with key K.
+#define LOC_IS_WORD( T ) ( (T).keys[i] == K && LOC_STR_IS_STR( T ) )
 
-		else if ( lhs[i] > rhs[i] ) return false;
-	}
+// For comparing the word in spot I of table A to the word in spot J of table B.
+#define SPOT_H_LT_H( A, I, B, J ) ( (A).keys[I] < (B).keys[J] )
+#define SPOT_H_IS_H( A, I, B, J ) ( (A).keys[I] == (B).keys[J] )
+#define SPOT_LT_SPOT( A, I, B, J ) ( SPOT_H_LT_H( A, I, B, J ) || ( SPOT_H_IS_H( A, I, B, J ) && Key::truncated( (A).keys[I] ) && (A).words[I]->str() < (B).words[J]->str() ) )
 
-	// If they are equal up to that point, check their lengths.
-	if ( lhs.length() >= rhs.length() ) return false;
+// The key stored in an empty spot. It is greater than any real key, so a probe
+// will always stop at an empty spot without having to check for one.
+#define EMPTY BIN( ~BIN( 0 ) )
 
-	return true;
+// The count stored in a spot whose real count is in its word struct.
+#define PROMOTED std::numeric_limits<uint32_t>::max()
+
+// The number of spots of the old list that each insert() or remove() moves to
+// the new list while resizing incrementally. The new list is twice as big, so
+// this has to be at least 2 for the move to finish before the new list needs
+// to be resized too.
+#define MIGRATE_STEP 64
+
+// How many new words to insert between samples of the load factor.
+#define LOAD_SAMPLE_WORDS ( 1 << 16 )
+
+// How many counts or offsets save() writes at a time.
+#define SAVE_BLOCK 4096
+
+// How many words ahead of the one being inserted or found by insertBatch() and
+// findBatch() to start loading the spot of. Must be a power of 2.
+#define BATCH_AHEAD 8
+
+// Spreads the keys of a batch out over its hash table.
+#define BATCH_MIX 0x9E3779B97F4A7C15ull
+
+// Starts loading spot I of table T.
+#define PREFETCH_SPOT( T, I ) ( PREFETCH( (T).keys + (I) ), PREFETCH( (T).nums + (I) ) )
+
+
+#ifdef DICT_STATS
+namespace
+{
+	/*! @struct
+		@brief Adds the time from its creation to its destruction to a total. */
+	struct stopwatch
+	{
+		double & total; //!< The total to add to.
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now(); //!< When it was created.
+
+		~stopwatch() { total += std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count(); }
+	};
 }
+#endif
 
 
-/*!
-@brief A list of numbers 28^n, for 0 < n < 24.
-*/
-const BFN POW28[25] = {				 28.L,
-									784.L,
-								  21952.L, // < 2^16
-								 614656.L,
-							   17210368.L,
-							  481890304.L, // < 2^32
-							13492928512.L,
-						   377801998336.L,
-						 10578455953408.L,
-						296196766695424.L,
-					   8293509467471872.L,
-					 232218265089212416.L,
-					6502111422497947648.L, // < 2^64
-				  182059119829942534144.L,
-				 5097655355238390956032.L,
-			   142734349946674946768896.L,
-			  3996561798506898509529088.L,
-			111903730358193158266814464.L,
-		   3133304450029408431470804992.L,
-		  87732524600823436081182539776.L,
-		2456510688823056210273111113728.L,
-	   68782299287045573887647111184384.L,
-	 1925904380037276068854119113162752.L,
-	53925322641043729927915335168557056.L,
-  1509909033949224437981629384719597568.L };
-/* Windows 10 calculator ran out of digits for the last three...
-340282366920938463463374607431768211456 == 2^128 */
+template <class Key>
+dictionary<Key>::table::table( const size_t num ) : capacity( num ), scale( Key::scale( num ) )
+{
+	keys = new BIN[num+1];
+	nums = new uint32_t[num+1];
+	words = new word*[num+1];
 
+	// Only the hashes need to be initialized, since the other arrays are only
+	// read where there is a hash.
+	std::fill( keys, keys + num + 1, EMPTY );
+}
 
-dictionary::dictionary( const size_t num )
+template <class Key>
+dictionary<Key>::table::~table()
 {
-	// Allocate space for 'num' word pointers and set them to nullptr. One
-	// extra spot is allocated to assist in overflow detection.
-	list = new word*[num+1]();
+	delete[] keys;
+	delete[] nums;
+	delete[] words;
+}
 
-	count.capacity = num;
+template <class Key>
+void dictionary<Key>::table::swap( table & other )
+{
+	std::swap( capacity, other.capacity );
+	std::swap( scale, other.scale );
+	std::swap( keys, other.keys );
+	std::swap( nums, other.nums );
+	std::swap( words, other.words );
 }
 
-dictionary::~dictionary()
+
+template <class Key>
+dictionary<Key>::dictionary( const size_t num ) : list( num ? num : 1 )
 {
-	// Delete the words in the list.
-	for ( size_t i = 0; i < count.capacity; ++i )
-		delete list[i];
+	// A capacity of 0 could never be doubled, so always allocate at least 1.
+}
 
-	// Delete the array of word pointers.
-	delete[] list;
+template <class Key>
+dictionary<Key>::~dictionary()
+{
+	// The table is deleted along with 'list', and the words themselves are
+	// freed along with the arena.
 }
 
 
-size_t dictionary::insert( const std::string & str, const size_t num )
+template <class Key>
+size_t dictionary<Key>::insert( const std::string_view str, const size_t num )
 {
-	if ( !str.empty() )
+	if ( !str.empty() ) return insertKey( Key::pack( str ), str, num );
+
+	return 0;
+}
+
+template <class Key>
+void dictionary<Key>::insertBatch( const std::string_view * const W, const size_t n, uint32_t * const ids )
+{
+	// Collect the different words of the batch and how many times each one
+	// occurs, with a small hash table of their indexes in 'batch'. Spots of
+	// 'seen' that weren't marked for this batch are empty, so it never has
+	// to be cleared.
+	size_t spots = 1;
+	while ( spots < 2 * n ) spots <<= 1;
+	if ( seen.size() < spots ) seen.assign( spots, std::make_pair( uint32_t( 0 ), uint32_t( 0 ) ) );
+	spots = seen.size();
+
+	if ( !++batches )
 	{
-		// If the list is over 75% full, resize it.
-		if ( 4 * count.size > 3 * count.capacity )
+		std::fill( seen.begin(), seen.end(), std::make_pair( uint32_t( 0 ), uint32_t( 0 ) ) );
+		batches = 1;
+	}
+
+	batch.clear();
+
+	for ( size_t j = 0; j < n; ++j )
+	{
+		if ( W[j].empty() )
 		{
-			resize( count.capacity << 1 );
+			if ( ids ) ids[j] = DICT_NO_ID;
 
-			return insert( str, num );
+			continue;
 		}
 
-		// Get the hash of the word to insert.
-		const BFN H = hash( str );
-		// Convert it to an int.
-		const BIN Hint = RE_CAST_BIN(H);
+		const BIN K = Key::pack( W[j] );
+		size_t s = size_t( mulhi( uint64_t( Key::top( K ) ) * BATCH_MIX, spots ) );
 
-		// The location that the hash of the word to insert points to.
-		word ** location = &list[size_t(H*count.capacity)];
+		while ( true )
+		{
+			// A new word gets the spot.
+			if ( seen[s].first != batches )
+			{
+				if ( ids ) ids[j] = uint32_t( batch.size() );
 
-		// While the location is not a nullptr, and the hash at the location is
-		// less than the hash of string being inserted.
-		while ( *location && LOC_H_LT_HINT )
-			++location; // Increment the location.
+				seen[s] = std::make_pair( batches, uint32_t( batch.size() ) );
+				batch.push_back( pending{ K, W[j], 1, DICT_NO_ID } );
 
-		#if BLOOMISH
-		// While the location is not a nullptr, and the string at the location
-		// is alphabetically 'less than' the string being inserted.
-		while ( *location && LOC_STR_LT_STR )
-			++location; // Increment the location.
-		#endif
+				break;
+			}
 
-		// If we have found an empty spot,
-		if ( *location == nullptr )
-		{
-			// check that it's within the space allocated for words. If it's
-			// not, resize the list.
-			if ( location == &list[count.capacity] )
+			// A word seen before gets counted again.
+			pending & p = batch[seen[s].second];
+			if ( p.key == K && ( !Key::truncated( K ) || p.str == W[j] ) )
 			{
-				resize( count.capacity << 1 );
+				if ( ids ) ids[j] = seen[s].second;
+
+				++p.num;
 
-				// We know the word isn't in the list now, so we can allocate
-				// new space for it. We then need to increment 'count.size'.
-				++count.size; return insert( new word( str, num, H ) );
+				break;
 			}
 
-			*location = new word( str, num, H ); // Otherwise, insert the word in that spot,
+			if ( ++s == spots ) s = 0;
+		}
+	}
 
-			++count.size; // increment the count of words in the list, and
+	// Insert each different word once, loading the spot of the word
+	// BATCH_AHEAD after it while it's being inserted.
+	for ( size_t j = 0; j < batch.size(); ++j )
+	{
+		if ( j + BATCH_AHEAD < batch.size() ) PREFETCH_SPOT( list, HOME( batch[j+BATCH_AHEAD].key, list ) );
+
+		if ( !ids ) insertKey( batch[j].key, batch[j].str, batch[j].num );
+		else
+		{
+			word * w = nullptr;
+			insertKey( batch[j].key, batch[j].str, batch[j].num, &w );
 
-			return num; // return 'num'.
+			batch[j].id = identify( w );
 		}
+	}
 
-		// If the word at this location is the same as the word we are
-		// inserting, increment the counter for that word and return it.
-		if ( LOC_H_IS_HINT && LOC_STR_IS_STR )
-			return ( (*location)->num += num );
+	// Each word's index in 'batch' becomes its id.
+	if ( ids )
+		for ( size_t j = 0; j < n; ++j )
+			if ( ids[j] != DICT_NO_ID ) ids[j] = batch[ids[j]].id;
+}
 
-		// At this point the word being inserted occurs alphabetically before
-		// the word at 'location', so we can create a new 'word' struct because
-		// we know the word being inserted doesn't yet exist in the list.
-		word * temp = new word( str, num, H ); ++count.size;
+template <class Key>
+size_t dictionary<Key>::find( const std::string_view str ) const
+{
+	if ( !str.empty() ) return findKey( Key::pack( str ), str );
 
-		// Then, while 'location' points to a word,
-		while ( *location )
-		{
-			std::swap( *location, temp ); // swap that word ptr with temp and
+	return 0;
+}
+
+template <class Key>
+void dictionary<Key>::findBatch( const std::string_view * const W, const size_t n, size_t * const counts ) const
+{
+	// The keys of the next BATCH_AHEAD words, whose spots are being loaded.
+	BIN ahead[BATCH_AHEAD];
+
+	for ( size_t j = 0; j < n && j < BATCH_AHEAD; ++j )
+	{
+		ahead[j] = ( W[j].empty() ? BIN( 0 ) : Key::pack( W[j] ) );
+		PREFETCH_SPOT( list, HOME( ahead[j], list ) );
+	}
+
+	for ( size_t j = 0; j < n; ++j )
+	{
+		const BIN K = ahead[j % BATCH_AHEAD];
 
-			++location; // increment 'location'.
+		if ( j + BATCH_AHEAD < n )
+		{
+			ahead[j % BATCH_AHEAD] = ( W[j+BATCH_AHEAD].empty() ? BIN( 0 ) : Key::pack( W[j+BATCH_AHEAD] ) );
+			PREFETCH_SPOT( list, HOME( ahead[j % BATCH_AHEAD], list ) );
 		}
 
-		// If we are now past the end of the list,
-		if ( location == &list[count.capacity] )
+		counts[j] = ( W[j].empty() ? 0 : findKey( K, W[j] ) );
+	}
+}
+
+template <class Key>
+size_t dictionary<Key>::remove( const std::string_view str, const size_t num )
+{
+	if ( !str.empty() )
+	{
+		// If we're in the middle of resizing, move a few more words.
+		if ( old.capacity ) migrate( MIGRATE_STEP );
+
+		// Get the key of the string.
+		const BIN K = Key::pack( str );
+
+		// If the word hasn't been moved out of the old list yet, remove it
+		// from there. Only spots after 'moved' are shifted, so this doesn't
+		// disturb the words that have already been moved.
+		if ( old.capacity )
 		{
-			resize( count.capacity << 1 ); // resize the list and
+			const size_t i = locate( old, K, str );
 
-			insert( temp ); // insert the last word we swapped.
+			if ( i >= moved && LOC_IS_WORD( old ) ) return removeAt( old, i, num );
 		}
 
-		// If we are not past the end of the list,
-		else *location = temp; // just insert that word in this spot.
+		// Get the spot the string should be in the list.
+		const size_t i = locate( list, K, str );
 
-		return num;
+		// If spot 'i' holds the word to remove, remove it.
+		if ( LOC_IS_WORD( list ) ) return removeAt( list, i, num );
 	}
 
 	return 0;
 }
 
-size_t dictionary::find( const std::string & str ) const
+template <class Key>
+void dictionary<Key>::merge( dictionary & other )
 {
-	// If the string is not blank.
-	if ( !str.empty() )
+	// Finish any resizes that are in progress.
+	if ( old.capacity ) migrate( old.capacity );
+	if ( other.old.capacity ) other.migrate( other.old.capacity );
+
+	// All of the words from both lists, in order, with duplicates combined.
+	// The histogram counts both first, and combine() joins the duplicates.
+	freqs.merge( other.freqs );
+
+	table merged( count + other.count );
+	const size_t m = combine( list, 0, other.list, merged );
+
+	// Pick a capacity that keeps the list under 75% full, and lay the words
+	// out in it.
+	size_t capacity = ( list.capacity > other.list.capacity ? list.capacity : other.list.capacity );
+	while ( 4 * m > 3 * capacity ) capacity <<= 1;
+
+	rebuild( merged, capacity );
+
+	count = m;
+
+	#ifdef DICT_STATS
+	// Keep what the other dictionary recorded, too.
+	for ( int i = 0; i < PROBE_BINS; ++i ) info.probes[i] += other.info.probes[i];
+	info.lookups += other.info.lookups;
+	info.probed += other.info.probed;
+	if ( other.info.longest > info.longest ) info.longest = other.info.longest;
+	info.compares += other.info.compares;
+	info.resizes += other.info.resizes;
+	info.resizeSeconds += other.info.resizeSeconds;
+	other.info = statistics();
+	#endif
+
+
+	// The other dictionary no longer owns any words, and the ids it gave its
+	// words would clash with this one's.
+	std::fill( other.list.keys, other.list.keys + other.list.capacity, EMPTY );
+	other.count = 0;
+	other.freqs.clear();
+	for ( word * const w : other.named ) w->id = DICT_NO_ID;
+	other.named.clear();
+	words.adopt( other.words );
+}
+
+template <class Key>
+void dictionary<Key>::addTo( dictionary & other )
+{
+	// Finish any resize that is in progress, so every word is in 'list'.
+	if ( old.capacity ) migrate( old.capacity );
+
+	for ( size_t i = 0; i < list.capacity; ++i )
+		if ( list.keys[i] != EMPTY ) other.insert( list.words[i]->str(), countAt( list, i ) );
+}
+
+template <class Key>
+size_t dictionary<Key>::prefix( const std::string_view pre, std::vector<std::pair<std::string_view, size_t>> & found )
+{
+	// Finish any resize that is in progress, so every word is in 'list'.
+	if ( old.capacity ) migrate( old.capacity );
+
+	const size_t before = found.size();
+
+	// A word starts with the prefix if the first characters of its key are
+	// the prefix's, which puts its key less than a span past the prefix's. If
+	// the prefix is longer than a key, or keys are lossy, the words have to be
+	// compared as strings, too.
+	const size_t length = std::min( Key::length( pre ), size_t( Key::chars ) );
+	const BIN K = ( length ? BIN( Key::pack( pre ) & ~Key::flag ) : BIN( 0 ) );
+	const BIN span = ( length ? Key::span( length ) : BIN( 0 ) );
+	const bool cut = ( Key::length( pre ) > Key::chars || Key::lossy );
+
+	// Start at the first word that isn't less than the prefix.
+	for ( size_t i = ( length ? locate( list, K, pre ) : 0 ); i < list.capacity; ++i )
 	{
-		// Get the string's hash.
-		const BFN H = hash( str );
-		// Convert it to an int.
-		const BIN Hint = RE_CAST_BIN( H );
-
-		// Get a pointer to the location that the string should be in the list.
-		word ** location = &list[size_t(H*count.capacity)];
-
-		// If that location is occupied by a string that is not this string,
-		// increment 'location'.
-		while ( *location && LOC_H_LT_HINT )
-			++location;
-		#if BLOOMISH
-		while ( *location && LOC_STR_LT_STR )
-			++location;
-		#endif
-
-		// If we have now found the string, return the number of occurences of
-		// it we have stored.
-		if ( *location && LOC_H_IS_HINT && LOC_STR_IS_STR )
-			return (*location)->num;
+		if ( list.keys[i] == EMPTY ) continue;
+
+		// The words that start with the prefix are all together, so the first
+		// one that doesn't is the end of them. Lossy keys mix in the words
+		// that share their keys, which are skipped.
+		if ( length && list.keys[i] - K >= span ) break;
+		if ( cut && list.words[i]->str().compare( 0, pre.size(), pre ) )
+		{
+			if ( Key::lossy ) continue;
+
+			break;
+		}
+
+		found.emplace_back( list.words[i]->str(), countAt( list, i ) );
 	}
 
-	// Otherwise return 0.
-	return 0;
+	if ( Key::lossy ) std::sort( found.begin() + before, found.end() );
+
+	return found.size() - before;
 }
 
-size_t dictionary::remove( const std::string & str, const size_t num )
+template <class Key>
+size_t dictionary<Key>::range( const std::string_view low, const std::string_view high, std::vector<std::pair<std::string_view, size_t>> & found )
 {
-	if ( !str.empty() )
+	// Finish any resize that is in progress, so every word is in 'list'.
+	if ( old.capacity ) migrate( old.capacity );
+
+	const size_t before = found.size();
+
+	// Lossy keys aren't in alphabetical order, so every word has to be
+	// compared.
+	if ( Key::lossy )
 	{
-		// Get the hash of the string.
-		const BFN H = hash( str );
-		// Convert it to an int.
-		const BIN Hint = RE_CAST_BIN(H);
-
-		// Get a pointer to the location the string should be in the list.
-		word ** location = &list[size_t(H*count.capacity)];
-
-		// While the location is not a nullptr, and the hash at the location is
-		// less than the hash of string being removed.
-		while ( *location && LOC_H_LT_HINT )
-			++location; // Increment the location.
-
-		#if BLOOMISH
-		// While the location is not a nullptr, and the string at the location
-		// is alphabetically 'less than' the string being removed.
-		while ( *location && LOC_STR_LT_STR )
-			++location; // Increment the location.
-		#endif
-
-		// If 'location' now points to the word to remove.
-		if ( *location && LOC_H_IS_HINT && LOC_STR_IS_STR )
+		for ( size_t i = 0; i < list.capacity; ++i )
 		{
-			// If we are removing more (or as many) occurences of that word
-			// than we have stored, delete the word.
-			if ( num >= (*location)->num )
-			{
-				delete *location;
+			if ( list.keys[i] == EMPTY ) continue;
+
+			const std::string_view str = list.words[i]->str();
 
-				// While there is another word right after this one and it is
-				// not in the location it should be, move it up one space.
-				while ( *(location+1) && location >= &list[size_t(((*(location+1))->hash)*count.capacity)] )
-				{
-					*location = *(location+1);
+			if ( str >= low && ( high.empty() || str <= high ) ) found.emplace_back( str, countAt( list, i ) );
+		}
 
-					++location;
-				}
+		std::sort( found.begin() + before, found.end() );
 
-				*(location+1) = nullptr;
+		return found.size() - before;
+	}
 
-				--count.size;
-			}
+	// Empty spots have the greatest key, so an empty 'high' has no end.
+	const BIN H = ( high.empty() ? EMPTY : Key::pack( high ) );
 
-			// Otherwise decrement that words' counter and return its value.
-			else return ( (*location)->num -= num );
-		}
+	// Start at the first word that isn't less than 'low'.
+	for ( size_t i = ( low.empty() ? 0 : locate( list, Key::pack( low ), low ) ); i < list.capacity; ++i )
+	{
+		if ( list.keys[i] == EMPTY ) continue;
+
+		// Stop at the first word after 'high'.
+		if ( list.keys[i] > H || ( list.keys[i] == H && Key::truncated( H ) && list.words[i]->str() > high ) ) break;
+
+		found.emplace_back( list.words[i]->str(), countAt( list, i ) );
 	}
 
-	return 0;
+	return found.size() - before;
 }
 
-
-size_t dictionary::size()
+template <class Key>
+void dictionary<Key>::incremental( const bool on )
 {
-	return count.size;
+	// If we're turning it off, finish any resize that's in progress.
+	if ( !on && old.capacity ) migrate( old.capacity );
+
+	slow = on;
 }
 
-void dictionary::print( std::ostream & txt, std::ostream & csv )
+template <class Key>
+bool dictionary<Key>::save( std::ostream & out )
 {
-	// This vector contains all of the words in the dictionary,
-	// sorted by frequency.
-	std::vector<std::vector<std::string>> frequency;
+	// Finish any resize that is in progress, so every word is in 'list'.
+	if ( old.capacity ) migrate( old.capacity );
+
+	const size_t spots = list.capacity;
 
-	size_t printed = 0; // Number of words that have been printed.
+	// Add up the counts, and the lengths of the words for the pool.
+	uint64_t total = 0, chars = 0;
+	for ( size_t i = 0; i < spots; ++i )
+	{
+		if ( list.keys[i] == EMPTY ) continue;
+
+		total += countAt( list, i );
+		chars += list.words[i]->length;
+	}
 
+	const snapshotheader head = snapshot<Key>::layout( spots, count, total, chars );
 
-	// for ( words in the dictionary )
-	for ( size_t i = 0; i < count.capacity; ++i )
+	out.write( reinterpret_cast<const char *>( &head ), sizeof( head ) );
+
+	// The keys, including the sentinel, are written straight from the list.
+	out.write( reinterpret_cast<const char *>( list.keys ), ( spots + 1 ) * sizeof( BIN ) );
+
+	// The counts and offsets are collected into blocks and written.
+	uint64_t block[SAVE_BLOCK];
+	size_t n = 0;
+	const auto put = [&]( const uint64_t value )
 	{
-		// If there is a word at this location,
-		if ( list[i] )
+		block[n++] = value;
+
+		if ( n == SAVE_BLOCK )
 		{
-			// and it's frequency is greater than the frequency vector is
-			// capable of holding, increase the size of the frequency vector
-			// so that it can be inserted.
-			if ( list[i]->num > frequency.size() ) frequency.resize( list[i]->num );
+			out.write( reinterpret_cast<const char *>( block ), n * sizeof( uint64_t ) );
+			n = 0;
+		}
+	};
 
-			// Insert the word into the frequency vector appropriately.
-			frequency[list[i]->num-1].push_back( list[i]->str );
+	for ( size_t i = 0; i < spots; ++i ) put( list.keys[i] == EMPTY ? 0 : countAt( list, i ) );
+
+	uint64_t offset = 0;
+	for ( size_t i = 0; i < spots; ++i )
+	{
+		put( offset );
+
+		if ( list.keys[i] != EMPTY ) offset += list.words[i]->length;
+	}
+	put( offset );
+
+	out.write( reinterpret_cast<const char *>( block ), n * sizeof( uint64_t ) );
+
+	// The words, in the same order.
+	for ( size_t i = 0; i < spots; ++i )
+		if ( list.keys[i] != EMPTY ) out.write( list.words[i]->str().data(), list.words[i]->length );
+
+	return bool( out );
+}
+
+template <class Key>
+void dictionary<Key>::load( const snapshot<Key> & snap )
+{
+	clear();
+
+	// Copy the snapshot's list spot for spot. It was laid out by a list of
+	// the same capacity, so every word is already in the right spot.
+	table loaded( snap.capacity() );
+	size_t words = 0;
+
+	for ( size_t i = 0; i < loaded.capacity; ++i )
+	{
+		if ( snap.key( i ) == EMPTY ) continue;
+
+		const size_t num = snap.count( i );
+
+		loaded.keys[i] = snap.key( i );
+		loaded.words[i] = newWord( snap.word( i ) );
+
+		// Counts too big for the list go in the word struct.
+		if ( num < PROMOTED ) loaded.nums[i] = uint32_t( num );
+		else
+		{
+			loaded.nums[i] = PROMOTED;
+			loaded.words[i]->num = num;
 		}
+
+		freqs.move( 0, num );
+
+		++words;
 	}
 
+	list.swap( loaded );
+	count = words;
+}
+
+template <class Key>
+void dictionary<Key>::clear()
+{
+	// Stop any resize that is in progress, since there's nothing to move.
+	table( 0 ).swap( old );
+	moved = 0;
+
+	std::fill( list.keys, list.keys + list.capacity, EMPTY );
+
+	count = 0;
+	freqs.clear();
+
+	named.clear();
+	words.release();
+}
+
 
-	// Headers
-	txt << "Word Frequencies                             Ranks     Avg Rank\n"
-		   "----------------                             -----     --------";
-	csv << "Rank,Frequency,Rank x Frequency";
+template <class Key>
+size_t dictionary<Key>::size()
+{
+	return count;
+}
 
+template <class Key>
+void dictionary<Key>::print( std::ostream & txt, std::ostream & csv )
+{
+	// Finish any resize that is in progress, so every word is in 'list'.
+	if ( old.capacity ) migrate( old.capacity );
 
-	// for ( frequencies in the frequency vector )
-	for ( int i = frequency.size() - 1; i >= 0; --i )
+	// The words are already in alphabetical order, so words with the same
+	// count are printed alphabetically. The histogram already has the CSV
+	// file, so only the text file is sorted for.
+	report::byCount( txt, nullptr, list.capacity,
+					 [this]( const size_t i ) { return ( list.keys[i] == EMPTY ? 0 : countAt( list, i ) ); },
+					 [this]( const size_t i ) { return list.words[i]->str(); } );
+
+	curve( csv );
+}
+
+template <class Key>
+void dictionary<Key>::curve( std::ostream & csv ) const
+{
+	std::vector<std::pair<size_t, size_t>> groups;
+	freqs.read( groups );
+
+	report::curve( csv, groups );
+}
+
+
+#ifdef DICT_STATS
+template <class Key>
+void dictionary<Key>::stats( std::ostream & json )
+{
+	// Finish any resize that is in progress, so every word is in 'list'.
+	if ( old.capacity ) migrate( old.capacity );
+
+	// Measure the clusters, and how far each word is from its spot.
+	size_t clusters = 0, longest = 0, run = 0, farthest = 0;
+	for ( size_t i = 0; i <= list.capacity; ++i )
 	{
-		// If there are words with this frequency.
-		if ( !frequency[i].empty() )
+		if ( list.keys[i] != EMPTY )
 		{
-			// Print the header for this frequency level.
-			txt << "\n\nWords occuring " << i + 1 << " time" << ( i ? "s:" : ":" );
-
-			// Convert the range of ranks covered by this frequency to a
-			// string, and calculate the average rank.
-			std::string ranks;
-			double avg = double( printed + 1 );
-			if ( frequency[i].size() > 1 )
-			{
-				ranks = std::to_string( printed + 1 ) + '-' + std::to_string( printed + frequency[i].size() );
-				printed += frequency[i].size();
-			}
-			else ranks = std::to_string( ++printed );
-			avg = avg + ( printed - avg ) / 2.0;
+			if ( !run++ ) ++clusters;
 
-			// Print the range of ranks and the average rank.
-			txt.width( 28 - std::to_string( i + 1 ).size() + ( i ? 0 : 1 ) );
-			txt << std::right << ranks;
-			txt.width( 13 ); txt.precision( 1 );
-			txt << std::fixed << std::right << avg;
+			if ( i - HOME( list.keys[i], list ) > farthest ) farthest = i - HOME( list.keys[i], list );
+		}
 
-			// Print the words that occur at this frequency level.
-			for ( size_t j = 0; j < frequency[i].size(); ++j )
-			{
-				if ( !( j % 5 ) ) txt << '\n';
-				txt.width( 15 );
-				txt << std::left << frequency[i][j];
-			}
+		else
+		{
+			if ( run > longest ) longest = run;
 
-			// Output CSV Info
-			csv << '\n' << avg << ',' << i + 1 << ',' << avg * ( i + 1 );
+			run = 0;
 		}
 	}
+
+	// Only write the probe lengths up to the longest one seen.
+	int bins = PROBE_BINS;
+	while ( bins && !info.probes[bins-1] ) --bins;
+
+	json << "{\n"
+		 << "  \"words\": " << count << ",\n"
+		 << "  \"capacity\": " << list.capacity << ",\n"
+		 << "  \"load\": " << double( count ) / list.capacity << ",\n"
+		 << "  \"lookups\": " << info.lookups << ",\n"
+		 << "  \"mean_probe\": " << ( info.lookups ? double( info.probed ) / info.lookups : 0.0 ) << ",\n"
+		 << "  \"max_probe\": " << info.longest << ",\n"
+		 << "  \"probe_histogram\": [";
+	for ( int i = 0; i < bins; ++i ) json << ( i ? ", " : "" ) << info.probes[i];
+	json << "],\n"
+		 << "  \"string_compares\": " << info.compares << ",\n"
+		 << "  \"clusters\": " << clusters << ",\n"
+		 << "  \"max_cluster\": " << longest << ",\n"
+		 << "  \"mean_cluster\": " << ( clusters ? double( count ) / clusters : 0.0 ) << ",\n"
+		 << "  \"max_displacement\": " << farthest << ",\n"
+		 << "  \"resizes\": " << info.resizes << ",\n"
+		 << "  \"resize_seconds\": " << info.resizeSeconds << ",\n"
+		 << "  \"load_samples\": [";
+	for ( size_t i = 0; i < info.loads.size(); ++i )
+		json << ( i ? ", " : "" ) << "[" << info.loads[i].first << ", " << info.loads[i].second << "]";
+	json << "]\n"
+		 << "}\n";
 }
+#endif
 
 
-size_t dictionary::insert( word * W )
+template <class Key>
+typename dictionary<Key>::word * dictionary<Key>::newWord( const std::string_view W )
 {
-	// If the list is over 75% full, resize it.
-	if ( 4 * count.size > 3 * count.capacity )
+	// Allocate space for the struct and the characters together.
+	void * const p = words.allocate( sizeof( word ) + W.size(), alignof( word ) );
+
+	word * const w = new( p ) word;
+	w->num = 0;
+	w->length = uint32_t( W.size() );
+	w->id = DICT_NO_ID;
+
+	// Copy the characters to right after the struct.
+	W.copy( reinterpret_cast<char *>( w + 1 ), W.size() );
+
+	return w;
+}
+
+template <class Key>
+uint32_t dictionary<Key>::identify( word * const w )
+{
+	if ( w->id == DICT_NO_ID )
+	{
+		w->id = uint32_t( named.size() );
+		named.push_back( w );
+	}
+
+	return w->id;
+}
+
+template <class Key>
+size_t dictionary<Key>::countAt( const table & T, const size_t i )
+{
+	return ( T.nums[i] != PROMOTED ? T.nums[i] : T.words[i]->num );
+}
+
+template <class Key>
+size_t dictionary<Key>::addAt( table & T, const size_t i, const size_t num )
+{
+	uint32_t & n = T.nums[i];
+
+	// If the new count still fits in the table, just add to it.
+	if ( n != PROMOTED && num < size_t( PROMOTED - n ) )
 	{
-		resize( count.capacity << 1 );
+		freqs.move( n, n + num );
 
-		return insert( W );
+		return ( n += uint32_t( num ) );
 	}
 
-	// The location that the hash of the word to insert points to.
-	word ** location = &list[size_t(W->hash*count.capacity)];
+	// Otherwise the count is kept in the word struct from now on.
+	if ( n != PROMOTED )
+	{
+		T.words[i]->num = n;
 
-	// W's hash, as an integer.
-	const BIN Hint = RE_CAST_BIN(W->hash);
-	// A reference to W's string for the #define'd comparisons.
-	const std::string & str = W->str;
+		n = PROMOTED;
+	}
 
-	// While the location is not a nullptr, and the hash at the location is
-	// less than the hash of the string being inserted.
-	while ( *location && LOC_H_LT_HINT )
-		++location; // Increment the location.
+	freqs.move( T.words[i]->num, T.words[i]->num + num );
 
-	#if BLOOMISH
-	// While the location is not a nullptr, and the string at the location
-	// is alphabetically 'less than' the string being inserted.
-	while ( *location && LOC_STR_LT_STR )
-		++location; // Increment the location.
-	#endif
+	return ( T.words[i]->num += num );
+}
+
+template <class Key>
+size_t dictionary<Key>::insertKey( const BIN K, const std::string_view str, const size_t num, word ** const at )
+{
+	// If we're in the middle of resizing, move a few more words.
+	if ( old.capacity ) migrate( MIGRATE_STEP );
+
+	// If the list is over 75% full, resize it.
+	if ( 4 * count > 3 * list.capacity ) resize();
 
-	// If we have found an empty spot,
-	if ( *location == nullptr )
+	// If the word hasn't been moved out of the old list yet, count it
+	// there.
+	if ( old.capacity )
 	{
-		// check that it's within the space allocated for words. If it's
-		// not, resize the list.
-		if ( location == &list[count.capacity] )
+		const size_t i = locate( old, K, str );
+
+		if ( i >= moved && LOC_IS_WORD( old ) )
 		{
-			resize( count.capacity << 1 );
+			if ( at ) *at = old.words[i];
 
-			return insert( W );
+			return addAt( old, i, num );
 		}
+	}
 
-		*location = W; // Otherwise, insert the word in that spot and
+	// Find the spot the word is in, or should be in.
+	const size_t i = locate( list, K, str );
+
+	// If the word at this spot is the same as the word we are inserting,
+	// increment the counter for that word and return it.
+	if ( LOC_IS_WORD( list ) )
+	{
+		if ( at ) *at = list.words[i];
 
-		return W->num; // return 'num'.
+		return addAt( list, i, num );
 	}
 
 	// At this point the word being inserted occurs alphabetically before
-	// the word at 'location', so we will make a copy of 'W->num',
-	const size_t temp = W->num;
-	// and then while 'location' points to a word,
-	while ( *location )
+	// the word at spot 'i', so every word from 'i' up to the next empty
+	// spot has to be moved over by one. If that would go past the end of
+	// the list, resize the list and try again.
+	if ( !makeRoom( list, i ) )
 	{
-		std::swap( *location, W ); // swap that word ptr with W and
+		resize();
 
-		++location; // increment 'location'.
+		return insertKey( K, str, num, at );
 	}
 
-	// If we are now past the end of the list,
-	if ( location == &list[count.capacity] )
+	// Then insert the word in that spot,
+	list.keys[i] = K;
+	list.nums[i] = 0;
+	list.words[i] = newWord( str );
+
+	if ( at ) *at = list.words[i];
+
+	++count; // increment the count of words in the list, and
+
+	STAT( if ( !( count % LOAD_SAMPLE_WORDS ) ) info.loads.emplace_back( count, list.capacity ); )
+
+	return addAt( list, i, num ); // set its count.
+}
+
+template <class Key>
+size_t dictionary<Key>::findKey( const BIN K, const std::string_view str ) const
+{
+	// If the word hasn't been moved out of the old list yet, it's there.
+	if ( old.capacity )
 	{
-		resize( count.capacity << 1 ); // resize the list and
+		const size_t i = locate( old, K, str );
 
-		insert( W ); // insert the last word we swapped.
+		if ( i >= moved && LOC_IS_WORD( old ) ) return countAt( old, i );
 	}
 
-	else *location = W; // Otherwise, insert that word in this spot.
+	// Get the spot that the string should be in the list.
+	const size_t i = locate( list, K, str );
 
-	return temp;
+	// If we have found the string, return the number of occurences of it
+	// we have stored.
+	if ( LOC_IS_WORD( list ) ) return countAt( list, i );
+
+	// Otherwise return 0.
+	return 0;
 }
 
-void dictionary::resize( const size_t newSize )
+template <class Key>
+size_t dictionary<Key>::locate( const table & T, const BIN K, const std::string_view str ) const
 {
-	std::cout << "    Resizing List\n";
+	// The spot that the key points to.
+	size_t i = HOME( K, T );
+
+	STAT( const size_t home = i; )
 
+	// While the key at the spot is less than the key of the string, go to the
+	// next spot. Empty spots have the greatest possible key, so this also
+	// stops at them.
+	while ( T.keys[i] < K ) ++i;
 
-	word ** oldList = list;
+	// While the spot has the same key, and the string at the spot is
+	// alphabetically 'less than' the string.
+	while ( T.keys[i] == K && LOC_STR_LT_STR( T ) ) ++i;
 
-	const size_t oldSize = count.capacity;
+	#ifdef DICT_STATS
+	const size_t length = i - home;
 
+	++info.lookups;
+	++info.probes[length < PROBE_BINS ? length : PROBE_BINS - 1];
+	info.probed += length;
+	if ( length > info.longest ) info.longest = length;
+	#endif
 
-	// Allocate space for 'num' word pointers and set them to nullptr. One
-	// extra spot is allocated to assist in overflow detection.
-	list = new word*[newSize+1]();
+	return i;
+}
 
-	count.capacity = newSize;
+template <class Key>
+bool dictionary<Key>::makeRoom( table & T, const size_t i )
+{
+	// Find the next empty spot.
+	size_t j = i;
+	while ( T.keys[j] != EMPTY ) ++j;
 
-	// Move all of the words from the old list to the new list.
-	for ( size_t i = 0; i < oldSize; ++i )
-		if ( oldList[i] ) insert( oldList[i] );
+	// If it's past the end of the table, there's no room.
+	if ( j == T.capacity ) return false;
 
+	// Otherwise move every word from 'i' to 'j' over by one.
+	std::copy_backward( T.keys + i, T.keys + j, T.keys + j + 1 );
+	std::copy_backward( T.nums + i, T.nums + j, T.nums + j + 1 );
+	std::copy_backward( T.words + i, T.words + j, T.words + j + 1 );
 
-	delete[] oldList;
+	return true;
 }
 
-BFN dictionary::hash( const std::string & str ) const
+template <class Key>
+size_t dictionary<Key>::removeAt( table & T, size_t i, const size_t num )
 {
-	if ( !str.empty() )
+	const size_t n = countAt( T, i );
+
+	// If we are removing fewer occurences of that word than we have stored,
+	// decrement that words' counter and return its value.
+	if ( num < n )
+	{
+		freqs.move( n, n - num );
+
+		if ( T.nums[i] == PROMOTED ) return ( T.words[i]->num -= num );
+
+		return ( T.nums[i] -= uint32_t( num ) );
+	}
+
+	freqs.move( n, 0 );
+
+	// Otherwise remove the word. Its memory stays in the arena until the
+	// dictionary is cleared. While there is another word right after this
+	// one and it is not in the spot it should be, move it up one spot.
+	while ( T.keys[i+1] != EMPTY && HOME( T.keys[i+1], T ) <= i )
+	{
+		T.keys[i] = T.keys[i+1];
+		T.nums[i] = T.nums[i+1];
+		T.words[i] = T.words[i+1];
+
+		++i;
+	}
+
+	T.keys[i] = EMPTY;
+
+	--count;
+
+	return 0;
+}
+
+template <class Key>
+void dictionary<Key>::resize()
+{
+	STAT( stopwatch timer{ info.resizeSeconds }; ++info.resizes; info.loads.emplace_back( count, list.capacity ); )
+
+	// Finish any resize that is already in progress. That may have made the
+	// list bigger already.
+	if ( old.capacity )
+	{
+		migrate( old.capacity );
+
+		if ( 4 * count <= 3 * list.capacity ) return;
+	}
+
+	// To resize incrementally, the current list becomes the old list, and
+	// words are moved out of it a few at a time by insert() and remove().
+	if ( slow )
+	{
+		old.swap( list );
+
+		table( old.capacity << 1 ).swap( list );
+
+		moved = 0;
+	}
+
+	// Otherwise move all of the words to a bigger list now.
+	else rebuild( list, list.capacity << 1 );
+}
+
+template <class Key>
+void dictionary<Key>::migrate( const size_t spots )
+{
+	STAT( stopwatch timer{ info.resizeSeconds }; )
+
+	const size_t last = ( old.capacity - moved > spots ? moved + spots : old.capacity );
+
+	for ( ; moved < last; ++moved )
+	{
+		if ( old.keys[moved] == EMPTY ) continue;
+
+		const BIN K = old.keys[moved];
+		const size_t i = locate( list, K, old.words[moved]->str() );
+
+		// If the word won't fit before the end of the new list, give up on
+		// moving words one at a time, and move everything to a bigger list.
+		if ( !makeRoom( list, i ) )
+		{
+			STAT( ++info.resizes; )
+
+			table merged( count );
+			combine( old, moved, list, merged );
+
+			rebuild( merged, list.capacity << 1 );
+
+			moved = old.capacity;
+
+			break;
+		}
+
+		list.keys[i] = K;
+		list.nums[i] = old.nums[moved];
+		list.words[i] = old.words[moved];
+	}
+
+	// If every word has been moved, the old list isn't needed anymore.
+	if ( moved == old.capacity )
+	{
+		table( 0 ).swap( old );
+
+		moved = 0;
+	}
+}
+
+template <class Key>
+size_t dictionary<Key>::combine( const table & A, size_t a, const table & B, table & merged )
+{
+	size_t b = 0, m = 0;
+
+	// Skip to the first word in each list.
+	while ( a < A.capacity && A.keys[a] == EMPTY ) ++a;
+	while ( b < B.capacity && B.keys[b] == EMPTY ) ++b;
+
+	// While either list has words left, take the lesser of the two.
+	while ( a < A.capacity || b < B.capacity )
 	{
-		// The first character won't be an apostrophe, so there's no need to
-		// check for that.
-		BFN hash = BFN( str[0] - 'a' ) / BFN( 27 );
+		// If they're the same word, keep A's and add B's count to it.
+		if ( a < A.capacity && b < B.capacity && !SPOT_LT_SPOT( A, a, B, b ) && !SPOT_LT_SPOT( B, b, A, a ) )
+		{
+			const size_t n = countAt( B, b );
+
+			merged.keys[m] = A.keys[a]; merged.nums[m] = A.nums[a]; merged.words[m] = A.words[a];
+			addAt( merged, m, n );
+			freqs.move( n, 0 );
+
+			++a; ++b;
+		}
+
+		else if ( b == B.capacity || ( a < A.capacity && SPOT_LT_SPOT( A, a, B, b ) ) )
+		{
+			merged.keys[m] = A.keys[a]; merged.nums[m] = A.nums[a]; merged.words[m] = A.words[a];
+
+			++a;
+		}
+
+		else
+		{
+			merged.keys[m] = B.keys[b]; merged.nums[m] = B.nums[b]; merged.words[m] = B.words[b];
+
+			++b;
+		}
+
+		++m;
+
+		while ( a < A.capacity && A.keys[a] == EMPTY ) ++a;
+		while ( b < B.capacity && B.keys[b] == EMPTY ) ++b;
+	}
+
+	return m;
+}
 
-		// The lesser value between the length of the string and the maximum
-		// number of characters that can be represented in the chosen hash
-		// variable type.
-		const size_t length = ( str.size() > DICT_MAX_CHARS ? DICT_MAX_CHARS : str.size() );
+template <class Key>
+void dictionary<Key>::rebuild( const table & from, size_t capacity )
+{
+	// Lay the words out in a new list. If the end of the list overflowed, try
+	// a bigger list.
+	while ( true )
+	{
+		table bigger( capacity );
 
-		for ( size_t i = 1; i < length; ++i )
+		if ( spread( from, bigger ) )
 		{
-			// If the character is a lowercase letter.
-			if ( str[i] != '\'' ) hash += BFN( str[i] - '`' ) / POW28[i];
+			list.swap( bigger );
+
+			return;
 		}
 
-		// Get one extra character if needed. This is important in the case
-		// where DICT_MAX_CHARS is less than the size of a string. If that
-		// happens, then it is possible to have two strings: ??? and ???' (if
-		// DICT_MAX_CHARS == 4). In this case, both strings would have the same
-		// hash. To give the second string a different hash, we basically
-		// extend 'length' by 1. The chosen BFN is too small to completely
-		// support one extra character, but it's enough to differentiate the
-		// two examples given above.
-		if ( str.size() > length && str[length-1] == '\'' )
-			hash += BFN( str[length] - '`' ) / POW28[length];
-
-		return hash;
+		capacity <<= 1;
+	}
+}
+
+template <class Key>
+bool dictionary<Key>::spread( const table & from, table & to )
+{
+	size_t next = 0; // The first spot that hasn't been taken yet.
+
+	for ( size_t i = 0; i < from.capacity; ++i )
+	{
+		if ( from.keys[i] == EMPTY ) continue;
+
+		// Put the word at its key's spot, or right after the previous word.
+		const size_t home = HOME( from.keys[i], to );
+
+		if ( home > next ) next = home;
+
+		if ( next == to.capacity ) return false;
+
+		to.keys[next] = from.keys[i];
+		to.nums[next] = from.nums[i];
+		to.words[next] = from.words[i];
+
+		++next;
 	}
 
-	return BFN( -1 );
+	return true;
 }
+
+
+template class dictionary<key64>;
+#ifdef __SIZEOF_INT128__
+template class dictionary<key128>;
+#endif
@@ -3,100 +3,155 @@
 
 @brief This file defines the dictionary class.
 
-The hash value of a word is stored as a floating point value. Due to floating
-point imprecision, there is a limit to the number of characters a word can
-have depending on the size of the floating point type used. However, smaller
-floating point types will be faster than larger ones. If the chosen data type
-is too small, similar words may be evaluated as if they were the same word.
-  Size   Max Characters   Note
- 16bit    2               Not sure what you can do with this.
- 32bit    4               Still not much room.
- 64bit   10               Enough for all words <= 10 characters long.
- 80bit   13               Enough for all words <= 13 characters long.
-128bit   23               Enough for all English words.
-
-Although some compilers support 80bit floating point numbers, there is no 80bit
-integer, so it may be considerably slower to use.
+The dictionary is a hash table where the hash of a word is its key, as defined
+in keys.h. Since keys are in alphabetical order, and a key's spot in the table
+is proportional to the key, the words in the table are always in alphabetical
+order. A word that isn't in its spot is always after it, and a run of words
+from one empty spot to the next is always sorted.
+
+The key type is a template parameter. Smaller keys make the table smaller and
+faster to search, but words that don't fit in a key need to have their strings
+compared. Both key64 and key128 are compiled into dictionary.cpp, so the one to
+use can be picked at runtime.
+
+Since the list is in alphabetical order, finding every word in a range, or
+every word with a prefix, only has to locate() the first one and read forward
+until the words stop matching. Lossy keys, like those of the utf8 alphabet,
+keep words in the order of their keys but not alphabetically, so a prefix
+skips the words that only share its key, and a range reads every word.
+
+A word can also be given a small id by insertBatch(), so that something else,
+like a table of n-grams, can refer to it in 4 bytes instead of by its string,
+and get the string back with wordOf().
+
+A dictionary can be saved to a snapshot file, as defined in snapshot.h, which
+can be memory mapped and searched without loading it, or loaded back into a
+dictionary to keep counting.
+
+If DICT_STATS is defined, the dictionary also records how long its probes are,
+how often strings are compared, and how often and for how long it resizes, and
+stats() writes them out as JSON. This slows the dictionary down, so it's off
+by default. Every file that includes this one must be compiled with the same
+setting.
 ******************************************************************************/
 
 #ifndef DICTIONARY_H
 #define DICTIONARY_H
 
+#include <cstdint>
+#include <iosfwd>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "arena.h"
+#include "histogram.h"
+#include "keys.h"
 
-// The data type to use.
-// 0 = float (32 bit)
-// 1 = double (64 bit)
-// 2 = long double (80 bit, unless you're using MSVC++, then it's 64 bit)
-// 3 = __float128 (128 bit, only available in GCC >= v4.6)
-#define BFN_DEF 1
-
-// Set to 'true' to use something like a Bloom Filter. This will allow you to
-// use a smaller data type than necessary to get correct results. Set this to
-// 'false' if your chosen data type is large enough on its own. If your chosen
-// data type is not supported by your compiler, a smaller type will be chosen
-// and 'BLOOMISH' will be set to 'true'.
-#define BLOOMISH true
-
-
-// BFN = Big Floating-Point Number
-// BIN = Big Integer Number
-// Used for Hashing
-// Don't touch this chunk of preprocessor stuff.
-#if BFN_DEF == 3
-	#if !( __GNUC__ > 4 || ( __GNUC__ == 4 && __GNUC_MINOR__ >= 6 ) )
-		#undef BFN_DEF
-		#define BFN_DEF 2
-		#undef BLOOMISH
-		#define BLOOMISH true
-	#endif
-#endif
-#if BFN_DEF == 0
-	typedef float BFN;
-	typedef uint32_t BIN;
-	#define DICT_MAX_CHARS 5
-#elif BFN_DEF == 1
-	typedef double BFN;
-	typedef uint64_t BIN;
-	#define DICT_MAX_CHARS 11
-#elif BFN_DEF == 2
-	typedef long double BFN;
-	#ifdef _MSC_VER
-		typedef uint64_t BIN;
-		#define DICT_MAX_CHARS 11
-		#undef BLOOMISH
-		#define BLOOMISH true
-	#else
-		typedef long double BIN; // There is no 80-bit integer.
-		#define DICT_MAX_CHARS 14
-	#endif
-#elif BFN_DEF == 3 // GCC >= 4.6 Only
-	typedef __float128 BFN;
-	typedef unsigned __int128 BIN;
-	#define DICT_MAX_CHARS 24
-#endif
 
-#undef BFN_DEF
+template <class Key>
+class snapshot;
+
+
+// The id of a word that hasn't been given one.
+#define DICT_NO_ID UINT32_MAX
+
+#ifdef DICT_STATS
+// The number of probe lengths counted separately. Longer probes are counted
+// in the last bin.
+#define PROBE_BINS 64
+#endif
 
 
 /*! @class
 	@brief The 'dictionary' class declaration. */
+template <class Key>
 class dictionary
 {
 	private:
 
+	typedef typename Key::type BIN; //!< The integer type of a key.
+
 	/*! @struct
-		@brief The 'word' struct definition. */
+		@brief The 'word' struct definition. Words are allocated from the
+		dictionary's arena, with the characters stored right after the
+		struct. */
 	struct word
 	{
-		word( const std::string & W, const size_t N, const BFN & H ) : hash( H ), num( N ), str( W ) {}
+		size_t num; //!< The count of this word, if it's too big for the table.
+
+		uint32_t length; //!< The number of characters in the word.
+
+		uint32_t id; //!< The id of this word, or DICT_NO_ID if it hasn't been given one.
+
+		/*! @brief Returns the characters stored after this struct. */
+		std::string_view str() const { return std::string_view( reinterpret_cast<const char *>( this + 1 ), length ); }
+	};
+
+	/*! @struct
+		@brief The 'table' struct definition. The hash table is stored as
+		parallel arrays, so that probing only reads the keys, which are packed
+		together, and never follows a pointer. One extra spot is allocated at
+		the end of each array to assist in overflow detection. */
+	struct table
+	{
+		table( const size_t num );
+		~table();
+
+		table( const table & ) = delete;
+		table & operator = ( const table & ) = delete;
+
+		/*! @brief Swaps the contents of two tables. */
+		void swap( table & other );
+
+		size_t capacity; //!< The number of spots in the table.
+
+		uint64_t scale; //!< The multiplier from a key to its spot.
+
+		BIN * keys; //!< The key of the word in each spot, or EMPTY.
+
+		uint32_t * nums; //!< The count of the word in each spot, or PROMOTED.
+
+		word ** words; //!< The word in each spot.
+	};
+
+	/*! @struct
+		@brief The 'pending' struct definition. A different word of a batch
+		being inserted, and how many times it occurs in the batch. */
+	struct pending
+	{
+		BIN key; //!< The key of the word.
+
+		std::string_view str; //!< The word.
+
+		size_t num; //!< The number of copies of the word in the batch.
+
+		uint32_t id; //!< The id of the word, once it's inserted, if ids were asked for.
+	};
+
+	#ifdef DICT_STATS
+	/*! @struct
+		@brief The 'statistics' struct definition. Records how the dictionary
+		has been used, for tuning its sizing. */
+	struct statistics
+	{
+		size_t probes[PROBE_BINS] = {}; //!< The number of lookups with each probe length.
+
+		size_t lookups = 0; //!< The number of lookups.
 
-		BFN hash; //!< The hash of this word.
+		size_t probed = 0; //!< The total probe length of every lookup.
 
-		size_t num; //!< The number of times this word appears.
+		size_t longest = 0; //!< The longest probe.
 
-		const std::string str; //!< The word to store.
+		size_t compares = 0; //!< The number of string compares.
+
+		size_t resizes = 0; //!< The number of times the list was made bigger.
+
+		double resizeSeconds = 0; //!< The time spent resizing.
+
+		std::vector<std::pair<size_t, size_t>> loads; //!< Word count and capacity over time.
 	};
+	#endif
 
 
 	public:
@@ -117,19 +172,47 @@ class dictionary
 	This function deletes the dictionary.
 	**************************************************************************/
 	~dictionary();
+
+	dictionary( const dictionary & ) = delete;
+	dictionary & operator = ( const dictionary & ) = delete;
 	
 	/**********************************************************************//**
 	@author John Colton
 
 	@par Description:
-	This function adds a word to the dictionary.
+	This function adds a word to the dictionary. The word is only copied if it
+	is not already in the dictionary, so 'str' may point into a larger buffer,
+	such as a memory mapped file.
 
 	@param[in] str - The word to add.
 	@param[in] num - The number of copies of the word to add. Defaults to 1.
 
 	@returns size_t - The number of copies of the word now in the dictionary.
 	**************************************************************************/
-	size_t insert( const std::string & str, const size_t num = 1 );
+	size_t insert( const std::string_view str, const size_t num = 1 );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds a block of words to the dictionary. Copies of the
+	same word within the block are counted together first, with a small hash
+	table, so each different word is only inserted once. Natural text repeats
+	its most common words so often that this skips most of the inserts. The
+	spot of each word is then loaded a few words before it is inserted, so
+	the list isn't waited on one word at a time.
+
+	If 'ids' is given, each word is also given an id, if it doesn't have one
+	yet, and the id of each word is written to it. Ids are numbered from 0 in
+	the order they're given out, and a word keeps its id until clear(), even
+	if it's removed. merge() takes the ids away from the other dictionary's
+	words.
+
+	@param[in] W - The words to add. Empty words are skipped.
+	@param[in] n - The number of words.
+	@param[out] ids - The id of each word, or DICT_NO_ID for an empty word.
+	                  Must have room for 'n' ids, if it's not null.
+	**************************************************************************/
+	void insertBatch( const std::string_view * const W, const size_t n, uint32_t * const ids = nullptr );
 	/**********************************************************************//**
 	@author John Colton
 
@@ -140,7 +223,32 @@ class dictionary
 
 	@returns size_t - The number of copies of the word in the dictionary.
 	**************************************************************************/
-	size_t find( const std::string & str ) const;
+	size_t find( const std::string_view str ) const;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the word that was given an id by insertBatch().
+
+	@param[in] id - The id.
+
+	@returns std::string_view - The word, which is valid until the dictionary
+	                            is cleared.
+	**************************************************************************/
+	std::string_view wordOf( const uint32_t id ) const { return named[id]->str(); }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds a block of words in the dictionary, loading the spot
+	of each word a few words before it is looked up.
+
+	@param[in] W - The words to find.
+	@param[in] n - The number of words.
+	@param[out] counts - The number of copies of each word in the dictionary.
+	                     Must have room for 'n' counts.
+	**************************************************************************/
+	void findBatch( const std::string_view * const W, const size_t n, size_t * const counts ) const;
 	/**********************************************************************//**
 	@author John Colton
 
@@ -153,7 +261,130 @@ class dictionary
 
 	@returns size_t - The number of copies of the word now in the dictionary.
 	**************************************************************************/
-	size_t remove( const std::string & str, const size_t num = -1 );
+	size_t remove( const std::string_view str, const size_t num = -1 );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds all of the words in another dictionary to this one.
+	Since both lists are kept in hash order, this is a linear merge of the two
+	lists rather than an insert() for every word. The words are moved out of
+	'other', which is left empty.
+
+	@param[in,out] other - The dictionary to merge into this one.
+	**************************************************************************/
+	void merge( dictionary & other );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds all of the words in this dictionary to another one,
+	with an insert() for each. Unlike merge(), this dictionary is left as it
+	is, and the cost depends only on the size of this dictionary, so it is
+	better for adding many small dictionaries to one big one.
+
+	@param[in,out] other - The dictionary to add the words to.
+	**************************************************************************/
+	void addTo( dictionary & other );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds every word that starts with a prefix, in alphabetical
+	order. It starts at the spot the prefix would be in, and stops at the
+	first word that doesn't start with it, so it only reads the spots between
+	the words it finds.
+
+	@param[in] pre - The prefix. Like a word, it may only have lowercase
+	                 characters of the alphabet, and may not start with an
+	                 apostrophe. If it is empty, every word matches.
+	@param[out] found - The words and their counts are added to the end of
+	                    this. The words are only valid until the dictionary
+	                    is changed.
+
+	@returns size_t - The number of words found.
+	**************************************************************************/
+	size_t prefix( const std::string_view pre, std::vector<std::pair<std::string_view, size_t>> & found );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds every word that is alphabetically between two words,
+	including the words themselves, in alphabetical order. Like prefix(), it
+	only reads the spots between the words it finds.
+
+	@param[in] low - The first word. If it is empty, the range starts at the
+	                 first word in the dictionary.
+	@param[in] high - The last word. If it is empty, the range ends at the
+	                  last word in the dictionary.
+	@param[out] found - The words and their counts are added to the end of
+	                    this. The words are only valid until the dictionary
+	                    is changed.
+
+	@returns size_t - The number of words found.
+	**************************************************************************/
+	size_t range( const std::string_view low, const std::string_view high, std::vector<std::pair<std::string_view, size_t>> & found );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function saves the dictionary as a snapshot, in the format described
+	in snapshot.h. The list is written as it is, empty spots and all, so the
+	snapshot can be searched the same way.
+
+	@param[in,out] out - The binary stream to write to.
+
+	@returns bool - True if everything was written.
+	**************************************************************************/
+	bool save( std::ostream & out );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function replaces the words in the dictionary with the words in a
+	snapshot. The snapshot's list is copied spot for spot, so nothing has to
+	be inserted or moved, and the words are copied into the arena so the
+	snapshot can be closed afterward.
+
+	@param[in] snap - The snapshot to load.
+	**************************************************************************/
+	void load( const snapshot<Key> & snap );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function removes every word from the dictionary, and frees the memory
+	used by the words. The capacity of the dictionary is not changed.
+	**************************************************************************/
+	void clear();
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function turns incremental resizing on or off. Normally, when the
+	dictionary gets too full, every word is moved to a bigger list at once,
+	which can make one insert() take a very long time. With incremental
+	resizing, the old and new lists are kept side by side, and each insert()
+	and remove() moves a few more words from the old list to the new one, so
+	no single call takes too long. This is slower overall.
+
+	@param[in] on - Whether to resize incrementally.
+	**************************************************************************/
+	void incremental( const bool on );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns whether incremental resizing is on.
+
+	@returns bool - True if the dictionary resizes incrementally.
+	**************************************************************************/
+	bool incremental() const { return slow; }
 
 	/**********************************************************************//**
 	@author John Colton
@@ -168,11 +399,51 @@ class dictionary
 	@author John Colton
 
 	@par Description:
-	This function prints the contents of this dictionary to an output stream.
+	This function prints the words in this dictionary grouped by how often
+	they occur, from most to least, as a report. The words are sorted by
+	count without being copied, and the CSV file is printed by curve().
 
-	@param[in,out] out - The output stream to print to.
+	@param[in,out] txt - The stream to print the words to.
+	@param[in,out] csv - The stream to print the ranks and frequencies to.
 	**************************************************************************/
 	void print( std::ostream & txt, std::ostream & csv );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints only the CSV file of print(), from the
+	histogram of counts the dictionary keeps up to date, without looking at
+	any of its words. It takes time proportional to the number of different
+	counts, so it can be printed again and again while words are still
+	being counted.
+
+	@param[in,out] csv - The stream to print the ranks and frequencies to.
+	**************************************************************************/
+	void curve( std::ostream & csv ) const;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the histogram of counts.
+
+	@returns const histogram & - How many words have each count.
+	**************************************************************************/
+	const histogram & frequencies() const { return freqs; }
+
+	#ifdef DICT_STATS
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function writes the statistics recorded by the dictionary as a JSON
+	object. Along with the probe lengths, string compares, resizes, and load
+	factor over time, it measures the clusters of words currently in the
+	list, where a cluster is a run of words from one empty spot to the next.
+
+	@param[in,out] json - The output stream to write to.
+	**************************************************************************/
+	void stats( std::ostream & json );
+	#endif
 
 
 	private:
@@ -181,52 +452,217 @@ class dictionary
 	@author John Colton
 
 	@par Description:
-	This function adds a word to the dictionary. Since this function is only
-	called by the other insert() and by resize(), it is assumed that the word
-	does not already exist in the list.
+	This function allocates a new word from the arena, along with a copy of
+	its characters.
+
+	@param[in] W - The word to copy.
+
+	@returns word * - The new word.
+	**************************************************************************/
+	word * newWord( const std::string_view W );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the id of a word, giving it the next one if it
+	doesn't have one yet.
+
+	@param[in,out] w - The word.
+
+	@returns uint32_t - The word's id.
+	**************************************************************************/
+	uint32_t identify( word * const w );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the count of the word in a spot of a table.
+
+	@param[in] T - The table.
+	@param[in] i - The spot.
+
+	@returns size_t - The number of times the word appears.
+	**************************************************************************/
+	static size_t countAt( const table & T, const size_t i );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds to the count of the word in a spot of a table, and
+	moves the word in the histogram. If the count no longer fits in 32 bits,
+	it is moved to the word struct.
+
+	@param[in,out] T - The table.
+	@param[in] i - The spot.
+	@param[in] num - The number to add.
+
+	@returns size_t - The number of times the word now appears.
+	**************************************************************************/
+	size_t addAt( table & T, const size_t i, const size_t num );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds a word to the dictionary, like insert(), once its key
+	has been packed.
+
+	@param[in] K - The key of the word. The word must not be empty.
+	@param[in] str - The word to add.
+	@param[in] num - The number of copies of the word to add.
+	@param[out] at - The word struct of the word is written to this, if it's
+	                 not null.
+
+	@returns size_t - The number of copies of the word now in the dictionary.
+	**************************************************************************/
+	size_t insertKey( const BIN K, const std::string_view str, const size_t num, word ** const at = nullptr );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds a word in the dictionary, like find(), once its key
+	has been packed.
+
+	@param[in] K - The key of the word. The word must not be empty.
+	@param[in] str - The word to find.
+
+	@returns size_t - The number of copies of the word in the dictionary.
+	**************************************************************************/
+	size_t findKey( const BIN K, const std::string_view str ) const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds the spot in a table that a word is in, or the spot it
+	would be inserted at if it's not in the table.
+
+	@param[in] T - The table to look in.
+	@param[in] K - The key of the word.
+	@param[in] str - The word.
+
+	@returns size_t - The spot.
+	**************************************************************************/
+	size_t locate( const table & T, const BIN K, const std::string_view str ) const;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function makes room for a word in a table by moving every word from
+	a spot up to the next empty spot over by one.
+
+	@param[in,out] T - The table.
+	@param[in] i - The spot to empty.
+
+	@returns bool - False if there is no empty spot before the end of the
+	                table, in which case nothing is moved.
+	**************************************************************************/
+	static bool makeRoom( table & T, const size_t i );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function removes copies of the word in a spot of a table. If every
+	copy is removed, the word is removed from the table.
 
-	@param[in] W - The word to add.
+	@param[in,out] T - The table.
+	@param[in] i - The spot.
+	@param[in] num - The number of copies to remove.
 
 	@returns size_t - The number of copies of the word now in the dictionary.
 	**************************************************************************/
-	size_t insert( word * W );
+	size_t removeAt( table & T, size_t i, const size_t num );
 
 	/**********************************************************************//**
 	@author John Colton
 
 	@par Description:
-	This function resizes the dictionary.
+	This function doubles the capacity of the dictionary, either all at once
+	or incrementally.
+	**************************************************************************/
+	void resize();
+	/**********************************************************************//**
+	@author John Colton
 
-	@param[in] newSize - The new capacity of the dictionary.
+	@par Description:
+	This function moves words from the old list to the new list during an
+	incremental resize. When every word has been moved, the old list is
+	deleted.
+
+	@param[in] spots - The number of spots of the old list to move.
 	**************************************************************************/
-	void resize( const size_t newSize );
+	void migrate( const size_t spots );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function merges the words in two tables into a third, in order. If
+	both tables have the same word, their counts are added together, and the
+	histogram, which must already count both words, is told so.
+
+	@param[in] A - The first table.
+	@param[in] a - The spot in A to start at.
+	@param[in] B - The second table.
+	@param[in,out] merged - The table to merge into, which must have room for
+	                        every word, and need not have any empty spots.
 
+	@returns size_t - The number of words in 'merged'.
+	**************************************************************************/
+	size_t combine( const table & A, size_t a, const table & B, table & merged );
 	/**********************************************************************//**
 	@author John Colton
 
 	@par Description:
-	This function calculates the hash of a string. It assumes the string only
-	contains apostrophes (not at the start or end) and lowercase letters.
+	This function replaces the list with a new list containing the words in
+	a table. If the words don't fit, the capacity is doubled until they do.
+
+	@param[in] from - The table to copy the words from.
+	@param[in] capacity - The capacity of the new list.
+	**************************************************************************/
+	void rebuild( const table & from, size_t capacity );
 
-	The idea is to read the string as a number in base 27 where an apostrophe
-	is 0 and lowercase letters are numbered from 1 to 26 alphabetically. Each
-	letter of the string is treated as a 'digit' after the decimal, resulting
-	in a number between 0 and 1. For example, "foo" would be converted to the
-	base 27 number "0.5FF", or (5/27)+(15/28^2)+(15/28^3), or
-	0.20500114728431054961667206565166 in base 10. (The first character cannot
-	be an apostrophe, so its value is reduced by 1 so that hashes will start at
-	0 instead of 1/27th.)
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function copies every word in one table into another, in order. Each
+	word is put at its hash location, or right after the previous word if that
+	word has already taken that spot. Since the words are already in order,
+	this never has to move a word that was already placed.
 
-	@param[in] str - The string to hashify.
+	@param[in] from - The table to copy from.
+	@param[in,out] to - The table to copy to. Must be empty.
 
-	@returns BFN - The hash value of the given string.
+	@returns bool - False if the words ran past the end of 'to'.
 	**************************************************************************/
-	BFN hash( const std::string & str ) const;
+	static bool spread( const table & from, table & to );
+
+	table list; //!< The hash table.
+
+	table old = table( 0 ); //!< The list being moved out of, if resizing.
+
+	size_t moved = 0; //!< The number of spots of 'old' that have been moved.
 
+	size_t count = 0; //!< The number of words in the dictionary.
 
-	struct { size_t capacity, size; } count = { 0, 0 };
+	histogram freqs; //!< How many words have each count.
 
-	word ** list = nullptr; //!< A pointer to the hash table.
+	bool slow = false; //!< Whether to resize incrementally.
+
+	arena words; //!< The memory the words are stored in.
+
+	std::vector<word *> named; //!< The word with each id.
+
+	std::vector<pending> batch; //!< The different words of the batch being inserted by insertBatch().
+
+	std::vector<std::pair<uint32_t, uint32_t>> seen; //!< insertBatch()'s hash table: the batch each spot was last used in, and the index of its word in 'batch'.
+
+	uint32_t batches = 0; //!< The number of batches inserted, which marks the spots of 'seen' used by the current one.
+
+	#ifdef DICT_STATS
+	mutable statistics info; //!< What has been recorded, including by find().
+	#endif
 };
 
 
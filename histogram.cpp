@@ -0,0 +1,160 @@
+#include <algorithm>
+#include "histogram.h"
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+	inline unsigned HIGHEST( const uint64_t m ) { unsigned long i; _BitScanReverse64( &i, m ); return i; }
+#else
+	#define HIGHEST( m ) unsigned( 63 - __builtin_clzll( m ) )
+#endif
+
+
+// The number of words in the bitmap of counters.
+#define USED_WORDS ( HISTOGRAM_DIRECT / 64 )
+
+// The number of words in the bitmap of the words of 'used'.
+#define SUMMARY_WORDS ( HISTOGRAM_DIRECT / 4096 )
+
+
+histogram::histogram() : direct( HISTOGRAM_DIRECT, 0 ), used( USED_WORDS, 0 ), summary()
+{
+}
+
+
+void histogram::merge( const histogram & other )
+{
+	// Only the counters the other histogram uses have to be added.
+	for ( size_t s = 0; s < SUMMARY_WORDS; ++s )
+	{
+		for ( uint64_t m = other.summary[s]; m; m &= m - 1 )
+		{
+			const size_t w = s * 64 + HIGHEST( m & -m );
+
+			for ( uint64_t u = other.used[w]; u; u &= u - 1 )
+			{
+				const size_t f = w * 64 + HIGHEST( u & -u );
+
+				if ( !direct[f] ) mark( f );
+				direct[f] += other.direct[f];
+			}
+		}
+	}
+
+	for ( const std::pair<size_t, size_t> & g : other.high )
+		for ( size_t j = 0; j < g.second; ++j ) addHigh( g.first );
+}
+
+void histogram::clear()
+{
+	std::fill( direct.begin(), direct.end(), 0 );
+	std::fill( used.begin(), used.end(), 0 );
+	std::fill( summary, summary + SUMMARY_WORDS, 0 );
+	high.clear();
+
+	kinds = 0;
+}
+
+
+void histogram::read( std::vector<std::pair<size_t, size_t>> & groups ) const
+{
+	groups.clear();
+	groups.reserve( kinds );
+	groups.insert( groups.end(), high.rbegin(), high.rend() );
+
+	// Go through the bitmaps from the highest bit down, skipping every word
+	// of them that is 0.
+	for ( size_t s = SUMMARY_WORDS; s-- > 0; )
+	{
+		for ( uint64_t m = summary[s]; m; )
+		{
+			const unsigned b = HIGHEST( m );
+			m ^= uint64_t( 1 ) << b;
+
+			const size_t w = s * 64 + b;
+
+			for ( uint64_t u = used[w]; u; )
+			{
+				const unsigned c = HIGHEST( u );
+				u ^= uint64_t( 1 ) << c;
+
+				const size_t f = w * 64 + c;
+				groups.emplace_back( f, direct[f] );
+			}
+		}
+	}
+}
+
+
+void histogram::mark( const size_t frequency )
+{
+	const size_t w = frequency / 64;
+
+	if ( !used[w] ) summary[w / 64] |= uint64_t( 1 ) << ( w % 64 );
+	used[w] |= uint64_t( 1 ) << ( frequency % 64 );
+
+	++kinds;
+}
+
+void histogram::unmark( const size_t frequency )
+{
+	const size_t w = frequency / 64;
+
+	used[w] &= ~( uint64_t( 1 ) << ( frequency % 64 ) );
+	if ( !used[w] ) summary[w / 64] &= ~( uint64_t( 1 ) << ( w % 64 ) );
+
+	--kinds;
+}
+
+void histogram::addHigh( const size_t to )
+{
+	const auto it = std::lower_bound( high.begin(), high.end(), std::make_pair( to, size_t( 0 ) ) );
+
+	if ( it != high.end() && it->first == to ) ++it->second;
+	else
+	{
+		high.insert( it, std::make_pair( to, size_t( 1 ) ) );
+
+		++kinds;
+	}
+}
+
+void histogram::moveHigh( const size_t from, const size_t to )
+{
+	size_t i = std::lower_bound( high.begin(), high.end(), std::make_pair( from, size_t( 0 ) ) ) - high.begin();
+
+	// If other words have the frequency too, this one just leaves it.
+	if ( high[i].second > 1 || !to )
+	{
+		if ( !--high[i].second )
+		{
+			high.erase( high.begin() + i );
+
+			--kinds;
+		}
+
+		if ( to ) addHigh( to );
+
+		return;
+	}
+
+	// A word that is alone at its frequency takes the new frequency with it,
+	// and is swapped into place, which is usually only a frequency or two
+	// away.
+	high[i].first = to;
+
+	while ( i + 1 < high.size() && high[i+1].first < to ) { std::swap( high[i], high[i+1] ); ++i; }
+	while ( i > 0 && high[i-1].first > to ) { std::swap( high[i], high[i-1] ); --i; }
+
+	// If another word already has the new frequency, join it.
+	size_t j = i;
+	if ( i + 1 < high.size() && high[i+1].first == to ) j = i + 1;
+	if ( i > 0 && high[i-1].first == to ) j = i - 1;
+
+	if ( j != i )
+	{
+		++high[j].second;
+		high.erase( high.begin() + i );
+
+		--kinds;
+	}
+}
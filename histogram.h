@@ -0,0 +1,200 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the histogram class.
+
+A histogram counts how many words occur each number of times, which is all the
+Zipf curve of a .csv file needs: one row per frequency, with the ranks of the
+words that occur that often. A dictionary keeps one up to date as its counts
+change, so the curve can be printed without looking at any of its words, in
+time proportional to the number of different frequencies rather than to the
+size of the dictionary.
+
+Frequencies below HISTOGRAM_DIRECT each have a counter of their own, so a
+change of count is one decrement and one increment. Two levels of bitmaps say
+which counters aren't 0, so reading them from the highest frequency down skips
+the empty ones 64 or 4096 at a time. The few higher frequencies, which only the
+most common words reach, are kept in a sorted vector. Adding to such a word's
+count usually only moves it past a frequency or two, so it's moved in place.
+******************************************************************************/
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+// Frequencies below this have a counter of their own. Must be a multiple of
+// 4096, so every word of the bitmaps is used.
+#define HISTOGRAM_DIRECT ( 1 << 16 )
+
+
+/*! @class
+	@brief The 'histogram' class declaration. */
+class histogram
+{
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes an empty histogram.
+	**************************************************************************/
+	histogram();
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function records that a word's count changed. A count of 0 means
+	the word isn't counted, so a new word changes from 0, and a removed one
+	changes to 0.
+
+	@param[in] from - The word's count before.
+	@param[in] to - The word's count now.
+	**************************************************************************/
+	void move( const size_t from, const size_t to )
+	{
+		if ( from == to ) return;
+
+		if ( from >= HISTOGRAM_DIRECT && to >= HISTOGRAM_DIRECT )
+		{
+			moveHigh( from, to );
+
+			return;
+		}
+
+		if ( from ) remove( from );
+		if ( to ) add( to );
+	}
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function records one more word with a count.
+
+	@param[in] frequency - The count. Must not be 0.
+	**************************************************************************/
+	void add( const size_t frequency )
+	{
+		if ( frequency >= HISTOGRAM_DIRECT ) addHigh( frequency );
+		else if ( !direct[frequency]++ ) mark( frequency );
+	}
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function records one less word with a count.
+
+	@param[in] frequency - The count. A word with it must have been added.
+	**************************************************************************/
+	void remove( const size_t frequency )
+	{
+		if ( frequency >= HISTOGRAM_DIRECT ) moveHigh( frequency, 0 );
+		else if ( !--direct[frequency] ) unmark( frequency );
+	}
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds the words of another histogram to this one.
+
+	@param[in] other - The histogram to add.
+	**************************************************************************/
+	void merge( const histogram & other );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function removes every word from the histogram.
+	**************************************************************************/
+	void clear();
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function lists every frequency that a word has, and how many words
+	have it, from the highest frequency to the lowest. This is the order a
+	report prints its groups in.
+
+	@param[out] groups - The frequencies and their numbers of words. Anything
+	                     in it before is replaced.
+	**************************************************************************/
+	void read( std::vector<std::pair<size_t, size_t>> & groups ) const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of different frequencies.
+
+	@returns size_t - The number of frequencies that at least one word has.
+	**************************************************************************/
+	size_t distinct() const { return kinds; }
+
+
+	private:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function sets the bits of a counter of 'direct' in the bitmaps, when
+	it stops being 0.
+
+	@param[in] frequency - The frequency of the counter.
+	**************************************************************************/
+	void mark( const size_t frequency );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function clears the bits of a counter of 'direct' in the bitmaps,
+	when it goes back to 0.
+
+	@param[in] frequency - The frequency of the counter.
+	**************************************************************************/
+	void unmark( const size_t frequency );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function records one more word with a frequency of at least
+	HISTOGRAM_DIRECT.
+
+	@param[in] to - The frequency.
+	**************************************************************************/
+	void addHigh( const size_t to );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function moves a word from one frequency of at least
+	HISTOGRAM_DIRECT to another, or removes it.
+
+	@param[in] from - The frequency the word had.
+	@param[in] to - The frequency the word has now, or 0 to remove it. Must
+	                be 0 or at least HISTOGRAM_DIRECT.
+	**************************************************************************/
+	void moveHigh( const size_t from, const size_t to );
+
+
+	std::vector<size_t> direct; //!< The number of words with each frequency below HISTOGRAM_DIRECT.
+
+	std::vector<uint64_t> used; //!< A bit for each counter of 'direct' that isn't 0.
+
+	uint64_t summary[HISTOGRAM_DIRECT / 4096]; //!< A bit for each word of 'used' that isn't 0.
+
+	std::vector<std::pair<size_t, size_t>> high; //!< The higher frequencies and their numbers of words, from the lowest frequency.
+
+	size_t kinds = 0; //!< The number of different frequencies.
+};
+
+
+#endif /* HISTOGRAM_H */
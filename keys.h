@@ -0,0 +1,321 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the key types the dictionary can use.
+
+A key is a word packed into an unsigned integer as a number in the radix of the
+alphabet (see alphabets.h), with the first character as its highest digit. In
+the default alphabet, an apostrophe is 1 and lowercase letters are numbered
+from 2 to 27 alphabetically, and 0 marks the end of the word. The first
+character can't be an apostrophe, so it's numbered from 0 to 25 instead. The
+radix is 32, so every character takes 5 bits: "foo" packed into 15 bits would
+be 00101 10001 10001. Other alphabets have other radixes, and pack a few more
+characters into a key than whole bits per character would.
+
+Comparing two keys as integers compares the words alphabetically, so the
+dictionary can keep its words in order. Unlike a floating point hash, this is
+exact: if a word fits in a key, no other word has the same key. Words that are
+too long to fit are cut off, and the dictionary compares their strings to tell
+them apart.
+  Type                 Bits   Max Characters (letters, other alphabets)
+  key64                  64   12, 12
+  key128                128   25, 24 to 26
+
+Bigger keys mean fewer string compares, but also a bigger table to search.
+******************************************************************************/
+
+#ifndef KEYS_H
+#define KEYS_H
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include "alphabets.h"
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+// Starts loading the memory at X into the cache, if the compiler can.
+#ifdef __GNUC__
+	#define PREFETCH( X ) __builtin_prefetch( X )
+#else
+	#define PREFETCH( X )
+#endif
+
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function multiplies two 64 bit numbers and returns the high 64 bits of the
+128 bit result.
+
+@param[in] a - The first number.
+@param[in] b - The second number.
+
+@returns uint64_t - The high 64 bits of a * b.
+******************************************************************************/
+inline uint64_t mulhi( const uint64_t a, const uint64_t b )
+{
+	#ifdef __SIZEOF_INT128__
+	return uint64_t( ( static_cast<unsigned __int128>( a ) * b ) >> 64 );
+	#else
+	uint64_t high; _umul128( a, b, &high ); return high;
+	#endif
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function divides a number, shifted up by 64 bits, by another number.
+
+@param[in] a - The number to shift and divide. It must be less than 'b'.
+@param[in] b - The number to divide by.
+
+@returns uint64_t - ( a * 2^64 ) / b.
+******************************************************************************/
+inline uint64_t divhi( const uint64_t a, const uint64_t b )
+{
+	#ifdef __SIZEOF_INT128__
+	return uint64_t( ( static_cast<unsigned __int128>( a ) << 64 ) / b );
+	#else
+	uint64_t rest; return _udiv128( a, 0, b, &rest );
+	#endif
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function makes the table of every power of a radix that fits in T, so
+keys can be padded with 0's without dividing or looping.
+
+@param[in] radix - The radix.
+
+@returns std::array<T, 128> - The powers, from radix^0, with 0 past the ones
+                              that fit.
+******************************************************************************/
+template <class T>
+constexpr std::array<T, 128> radixPowers( const unsigned radix )
+{
+	std::array<T, 128> powers = {};
+	T power = 1;
+
+	for ( size_t n = 0; n < powers.size(); ++n )
+	{
+		powers[n] = power;
+		if ( power > T( ~T( 0 ) ) / radix ) break;
+
+		power *= radix;
+	}
+
+	return powers;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function finds how many characters of a radix fit in a number of bits.
+
+@param[in] radix - The radix.
+@param[in] bits - The number of bits. It must be less than the bits of T.
+
+@returns unsigned - The most characters n for which radix^n <= 2^bits.
+******************************************************************************/
+template <class T>
+constexpr unsigned radixChars( const unsigned radix, const unsigned bits )
+{
+	const T limit = T( 1 ) << bits;
+	T power = 1;
+	unsigned n = 0;
+
+	for ( ; power <= limit / radix; ++n ) power *= radix;
+
+	return n;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function finds how many bits it takes to hold n characters of a radix.
+
+@param[in] radix - The radix.
+@param[in] n - The number of characters. radix^n must fit in T with a bit to
+               spare.
+
+@returns unsigned - The fewest bits b for which radix^n <= 2^b.
+******************************************************************************/
+template <class T>
+constexpr unsigned radixBits( const unsigned radix, const unsigned n )
+{
+	T power = 1;
+	for ( unsigned i = 0; i < n; ++i ) power *= radix;
+
+	unsigned b = 0;
+	while ( ( T( 1 ) << b ) < power ) ++b;
+
+	return b;
+}
+
+
+/*! @struct
+	@brief Packs a word of an alphabet into an unsigned integer type T. */
+template <class T, class Alphabet = alphabet>
+struct packedkey
+{
+	typedef T type; //!< The integer type of a key.
+
+	//! The number of bits in a key.
+	static const unsigned bits = sizeof( T ) * 8;
+
+	//! The number of values each character can have.
+	static const unsigned radix = Alphabet::radix;
+
+	//! True if the key of a word can be shared with other words that fit.
+	static const bool lossy = Alphabet::lossy;
+
+	//! The number of characters that fit in a key. The lowest bit is always
+	//! left free, and so is the one above it if the alphabet is lossy.
+	static const unsigned chars = radixChars<T>( radix, bits - 1 - lossy );
+
+	//! The number of unused bits at the bottom of a key.
+	static const unsigned spare = bits - radixBits<T>( radix, chars );
+
+	//! The number of values the first character can have.
+	static const unsigned firsts = Alphabet::firsts;
+
+	//! The bit set in a key whose word had a character that shares its number
+	//! with others, or 0 if the alphabet is not lossy.
+	static constexpr type flag = type( lossy ? 2 : 0 );
+
+	//! Every power of the radix up to radix^chars.
+	static constexpr std::array<T, 128> powers = radixPowers<T>( radix );
+
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function packs a word into a key. It assumes the word only contains
+	characters of the alphabet, lowercased, does not start with one that can
+	only be inside a word, and is not empty.
+
+	@param[in] str - The word to pack.
+
+	@returns type - The key.
+	**************************************************************************/
+	static type pack( const std::string_view str )
+	{
+		const char * pos = str.data(), * const end = pos + str.size();
+		bool folded = false;
+
+		type key = type( Alphabet::symbol( pos, end, folded ) - Alphabet::base );
+
+		size_t length = 1;
+		for ( ; length < chars && pos != end; ++length ) key = key * radix + Alphabet::symbol( pos, end, folded );
+
+		// Fill the rest of the key with 0's, which mark the end of the word.
+		return ( key * powers[chars - length] << spare ) | ( folded ? flag : type( 0 ) );
+	}
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function checks if a key might have been cut off, or has characters
+	that share their number. If so, two different words can have the same
+	key, so their strings must be compared.
+
+	@param[in] key - The key to check.
+
+	@returns bool - True if the word used every character of the key, or
+	                was folded.
+	**************************************************************************/
+	static bool truncated( const type key )
+	{
+		return ( key & flag ) || ( key >> spare ) % radix;
+	}
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the highest 64 bits of a key, which are used to
+	pick the key's spot in the table.
+
+	@param[in] key - The key.
+
+	@returns uint64_t - The highest 64 bits of the key.
+	**************************************************************************/
+	static uint64_t top( const type key )
+	{
+		return uint64_t( key >> ( bits - 64 ) );
+	}
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the multiplier that maps the top() of a key to a
+	spot in a table. Since the first character can't be every value, the
+	keys of words never reach the top of their range, so the multiplier is
+	scaled up to spread the keys that can happen over the entire table. With
+	a radix of 32 and 26 first characters, that is a scale of 32 / 26.
+
+	@param[in] capacity - The number of spots in the table.
+
+	@returns uint64_t - The multiplier. The spot for a key is
+	                    mulhi( top( key ), scale( capacity ) ).
+	**************************************************************************/
+	static uint64_t scale( const size_t capacity )
+	{
+		return divhi( uint64_t( capacity ), top( type( firsts ) * powers[chars - 1] << spare ) );
+	}
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns how many keys there are from one word to the next
+	one with a different start, which is how far apart the keys of two
+	prefixes of the same length are.
+
+	@param[in] length - The length of the start, from 1 to 'chars'.
+
+	@returns type - The number of keys.
+	**************************************************************************/
+	static type span( const size_t length )
+	{
+		return powers[chars - length] << spare;
+	}
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function counts the characters of a word, each of which takes one
+	digit of a key.
+
+	@param[in] str - The word.
+
+	@returns size_t - The number of characters.
+	**************************************************************************/
+	static size_t length( const std::string_view str )
+	{
+		return Alphabet::length( str );
+	}
+};
+
+
+typedef packedkey<uint64_t> key64; //!< Up to 12 characters.
+
+#ifdef __SIZEOF_INT128__
+typedef packedkey<unsigned __int128> key128; //!< Up to 24 to 26 characters.
+#endif
+
+
+#endif /* KEYS_H */
@@ -0,0 +1,98 @@
+#include <fstream>
+#include "mappedfile.h"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#define HAVE_MMAP true
+#else
+	#define HAVE_MMAP false
+#endif
+
+
+mappedfile::~mappedfile()
+{
+	close();
+}
+
+
+bool mappedfile::open( const std::string & path )
+{
+	close();
+
+	#if HAVE_MMAP
+	// Only regular files can be mapped. Check before opening, since opening
+	// a pipe would take its data away from whoever opens it next.
+	struct stat info;
+	if ( stat( path.c_str(), &info ) != 0 || !S_ISREG( info.st_mode ) ) return false;
+
+	const int fd = ::open( path.c_str(), O_RDONLY );
+	if ( fd < 0 ) return false;
+
+	if ( fstat( fd, &info ) != 0 || !S_ISREG( info.st_mode ) )
+	{
+		::close( fd );
+
+		return false;
+	}
+
+	length = size_t( info.st_size );
+
+	// An empty file can't be mapped, but it is still a valid file.
+	if ( length )
+	{
+		void * map = mmap( nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+		if ( map == MAP_FAILED )
+		{
+			::close( fd );
+
+			length = 0;
+
+			return false;
+		}
+
+		// We will only ever walk forward through the file once.
+		madvise( map, length, MADV_SEQUENTIAL );
+		madvise( map, length, MADV_WILLNEED );
+
+		begin = static_cast<const char *>( map );
+
+		mapped = true;
+	}
+
+	// The mapping stays valid after the descriptor is closed.
+	::close( fd );
+
+	return true;
+	#else
+	std::ifstream fin( path, std::ios_base::in | std::ios_base::binary );
+	if ( !fin ) return false;
+
+	// Get Filesize
+	length = size_t( fin.rdbuf()->pubseekoff( 0, std::ios_base::end, std::ios_base::in ) );
+	fin.rdbuf()->pubseekoff( 0, std::ios_base::beg, std::ios_base::in );
+
+	char * buffer = new char[length ? length : 1];
+	fin.rdbuf()->sgetn( buffer, length );
+
+	begin = buffer;
+
+	return true;
+	#endif
+}
+
+void mappedfile::close()
+{
+	#if HAVE_MMAP
+	if ( mapped ) munmap( const_cast<char *>( begin ), length );
+	else
+	#endif
+	delete[] begin;
+
+	begin = nullptr;
+	length = 0;
+	mapped = false;
+}
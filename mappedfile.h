@@ -0,0 +1,97 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the mappedfile class.
+
+A mappedfile maps an entire input file into memory so that words can be read
+straight out of the mapping without going through a std::streambuf. The kernel
+is told that the mapping will be read sequentially, so it can read ahead
+aggressively and drop pages behind us.
+
+On systems without mmap() the file is read into a buffer instead, which still
+avoids the per-character streambuf calls.
+******************************************************************************/
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+
+/*! @class
+	@brief The 'mappedfile' class declaration. */
+class mappedfile
+{
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes an empty mappedfile.
+	**************************************************************************/
+	mappedfile() = default;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function unmaps the file, if one is mapped.
+	**************************************************************************/
+	~mappedfile();
+
+	mappedfile( const mappedfile & ) = delete;
+	mappedfile & operator = ( const mappedfile & ) = delete;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function maps a file into memory. Any previously mapped file is
+	unmapped first.
+
+	@param[in] path - The name of the file to map.
+
+	@returns bool - True if the file was mapped.
+	**************************************************************************/
+	bool open( const std::string & path );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function unmaps the file.
+	**************************************************************************/
+	void close();
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns a pointer to the first byte of the file.
+
+	@returns const char * - The start of the file. May be nullptr if the file
+	                        is empty.
+	**************************************************************************/
+	const char * data() const { return begin; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the size of the file.
+
+	@returns size_t - The number of bytes in the file.
+	**************************************************************************/
+	size_t size() const { return length; }
+
+
+	private:
+
+	const char * begin = nullptr; //!< The start of the mapping.
+
+	size_t length = 0; //!< The length of the mapping.
+
+	bool mapped = false; //!< True if 'begin' came from mmap(), not new[].
+};
+
+
+#endif /* MAPPEDFILE_H */
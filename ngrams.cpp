@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include "ngrams.h"
+#include "report.h"
+
+
+// The fewest spots a gramtable has. Must be a power of 2.
+#define GRAM_MIN_SPOTS 16
+
+// Mixes the ids of an n-gram into its hash.
+#define GRAM_MIX 0x9E3779B97F4A7C15ull
+
+// How many words ahead of the one being counted by insertBatch() to start
+// loading the spots of the n-grams ending with.
+#define GRAM_AHEAD 8
+
+// The number of n-grams of N words on each line of a .wrd file, and how many
+// characters each is padded to, so that lines are as long as those of words.
+#define GRAM_COLUMNS( N ) ( REPORT_COLUMNS / (N) )
+#define GRAM_WIDTH( N ) ( REPORT_COLUMNS * REPORT_WIDTH / GRAM_COLUMNS( N ) )
+
+
+template <unsigned N>
+gramtable<N>::gramtable( const size_t num )
+{
+	// Keep the table under 75% full without having to grow.
+	size_t spots = GRAM_MIN_SPOTS;
+	while ( 3 * spots < 4 * num ) spots <<= 1;
+
+	slots.assign( spots, slot{ gram(), 0 } );
+
+	shift = 64;
+	while ( spots > 1 ) { spots >>= 1; --shift; }
+}
+
+
+template <unsigned N>
+void gramtable<N>::insert( const gram & g )
+{
+	if ( 4 * count >= 3 * slots.size() ) resize();
+
+	const size_t mask = slots.size() - 1;
+
+	for ( size_t i = home( g ); ; i = ( i + 1 ) & mask )
+	{
+		slot & s = slots[i];
+
+		if ( !s.num )
+		{
+			s.ids = g;
+			s.num = 1;
+
+			++count;
+
+			return;
+		}
+
+		if ( s.ids == g )
+		{
+			++s.num;
+
+			return;
+		}
+	}
+}
+
+template <unsigned N>
+void gramtable<N>::prefetch( const gram & g ) const
+{
+	PREFETCH( &slots[home( g )] );
+}
+
+
+template <unsigned N>
+size_t gramtable<N>::home( const gram & g ) const
+{
+	uint64_t h = 0;
+	for ( const uint32_t id : g ) h = ( h ^ id ) * GRAM_MIX;
+
+	return size_t( h >> shift );
+}
+
+template <unsigned N>
+void gramtable<N>::resize()
+{
+	std::vector<slot> from( slots.size() * 2, slot{ gram(), 0 } );
+	from.swap( slots );
+	--shift;
+
+	const size_t mask = slots.size() - 1;
+
+	// Every n-gram is different, so each one only needs an empty spot.
+	for ( const slot & s : from )
+	{
+		if ( !s.num ) continue;
+
+		size_t i = home( s.ids );
+		while ( slots[i].num ) i = ( i + 1 ) & mask;
+
+		slots[i] = s;
+	}
+}
+
+
+template <class Key>
+ngrams<Key>::ngrams( const size_t num, const unsigned longest ) : dict( num ), pairs( num ), triples( longest > 2 ? num : 0 ), most( longest )
+{
+	// There are more different pairs than words in any real text, so the
+	// tables start as big as the dictionary and grow from there.
+}
+
+
+template <class Key>
+void ngrams<Key>::insertBatch( const std::string_view * const W, const size_t n )
+{
+	// Count the words first, which gives each one its id.
+	ids.resize( n );
+	dict.insertBatch( W, n, ids.data() );
+
+	for ( size_t j = 0; j < n; ++j )
+	{
+		if ( j + GRAM_AHEAD < n )
+		{
+			const uint32_t * const a = &ids[j+GRAM_AHEAD];
+
+			pairs.prefetch( { a[-1], a[0] } );
+			if ( most > 2 ) triples.prefetch( { a[-2], a[-1], a[0] } );
+		}
+
+		const uint32_t id = ids[j];
+		if ( id == DICT_NO_ID ) continue;
+
+		// Count the n-grams that end with this word, once there are enough
+		// words before it.
+		if ( run > 0 )
+		{
+			pairs.insert( { last[0], id } );
+			++totals[2];
+		}
+
+		if ( most > 2 && run > 1 )
+		{
+			triples.insert( { last[1], last[0], id } );
+			++totals[3];
+		}
+
+		last[1] = last[0];
+		last[0] = id;
+
+		if ( run < NGRAM_MAX - 1 ) ++run;
+	}
+}
+
+
+template <class Key>
+void ngrams<Key>::print( const unsigned length, std::ostream & txt, std::ostream & csv ) const
+{
+	if ( length == 2 ) printTable( pairs, txt, csv );
+	else printTable( triples, txt, csv );
+}
+
+template <class Key>
+template <unsigned N>
+void ngrams<Key>::printTable( const gramtable<N> & table, std::ostream & txt, std::ostream & csv ) const
+{
+	// A report only points to its words, so each n-gram is spelled out once,
+	// with spaces between its words, into one buffer that never moves.
+	size_t chars = 0;
+	for ( size_t i = 0; i < table.capacity(); ++i )
+		if ( table.countAt( i ) )
+			for ( const uint32_t id : table.gramAt( i ) ) chars += dict.wordOf( id ).size() + 1;
+
+	std::vector<char> text( chars );
+	std::vector<std::pair<std::string_view, size_t>> found;
+	found.reserve( table.size() );
+
+	char * pos = text.data();
+	for ( size_t i = 0; i < table.capacity(); ++i )
+	{
+		if ( !table.countAt( i ) ) continue;
+
+		const char * const first = pos;
+		for ( const uint32_t id : table.gramAt( i ) )
+		{
+			if ( pos != first ) *pos++ = ' ';
+
+			const std::string_view word = dict.wordOf( id );
+			pos = std::copy( word.begin(), word.end(), pos );
+		}
+
+		found.emplace_back( std::string_view( first, pos - first ), table.countAt( i ) );
+	}
+
+	// The table is in hash order, so the n-grams are sorted for the ones with
+	// the same count to be printed alphabetically. A space comes before any
+	// character of a word, so this sorts them by their first word, and then
+	// by the next.
+	std::sort( found.begin(), found.end() );
+
+	report::byCount( txt, &csv, found.size(),
+					 [&found]( const size_t i ) { return found[i].second; },
+					 [&found]( const size_t i ) { return found[i].first; },
+					 GRAM_COLUMNS( N ), GRAM_WIDTH( N ) );
+}
+
+
+template class gramtable<2>;
+template class gramtable<3>;
+
+template class ngrams<key64>;
+#ifdef __SIZEOF_INT128__
+template class ngrams<key128>;
+#endif
@@ -0,0 +1,288 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the ngrams class.
+
+An ngrams counts every word, like a dictionary, and also every run of 2 or 3
+words in a row, in the same pass over the text. Each word is counted in a
+dictionary, which gives it an id, and an n-gram is then just the ids of its
+words: 8 bytes for a pair and 12 for a triple, however long the words are, in
+a gramtable that never compares a string. The words of an n-gram are only
+looked up again when it's printed.
+
+The last words of each block are remembered, so the n-grams that span two
+blocks are counted too. Because of that, the text has to be counted in order,
+on one thread.
+******************************************************************************/
+
+#ifndef NGRAMS_H
+#define NGRAMS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+#include "dictionary.h"
+
+
+// The longest n-grams that can be counted.
+#define NGRAM_MAX 3
+
+
+/*! @class
+	@brief The 'gramtable' class declaration. A hash table of the counts of
+	n-grams of N words, each given by the ids of its words. */
+template <unsigned N>
+class gramtable
+{
+	public:
+
+	typedef std::array<uint32_t, N> gram; //!< The ids of the words of an n-gram, in order.
+
+	/*! @struct
+		@brief The 'slot' struct definition. An n-gram and its count are
+		kept together, so that finding an n-gram and counting it only reads
+		one place. */
+	struct slot
+	{
+		gram ids; //!< The n-gram.
+
+		size_t num; //!< The count of the n-gram, or 0 if the slot is empty.
+	};
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes an empty table.
+
+	@param[in] num - The number of n-grams to allocate space for.
+	**************************************************************************/
+	gramtable( const size_t num = 1000 );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function counts one more copy of an n-gram.
+
+	@param[in] g - The n-gram.
+	**************************************************************************/
+	void insert( const gram & g );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function starts loading the spot of an n-gram, so that inserting it
+	a little later doesn't have to wait for it.
+
+	@param[in] g - The n-gram.
+	**************************************************************************/
+	void prefetch( const gram & g ) const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of different n-grams in the table.
+
+	@returns size_t - The number of n-grams.
+	**************************************************************************/
+	size_t size() const { return count; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of spots in the table, for reading every
+	n-gram with countAt() and gramAt().
+
+	@returns size_t - The number of spots.
+	**************************************************************************/
+	size_t capacity() const { return slots.size(); }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the count of the n-gram in a spot.
+
+	@param[in] i - The spot.
+
+	@returns size_t - The count, or 0 if the spot is empty.
+	**************************************************************************/
+	size_t countAt( const size_t i ) const { return slots[i].num; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the n-gram in a spot that isn't empty.
+
+	@param[in] i - The spot.
+
+	@returns const gram & - The n-gram.
+	**************************************************************************/
+	const gram & gramAt( const size_t i ) const { return slots[i].ids; }
+
+
+	private:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the spot an n-gram starts looking for its spot at.
+
+	@param[in] g - The n-gram.
+
+	@returns size_t - The spot.
+	**************************************************************************/
+	size_t home( const gram & g ) const;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function doubles the capacity of the table, and puts every n-gram
+	in its spot in the new one.
+	**************************************************************************/
+	void resize();
+
+
+	std::vector<slot> slots; //!< The n-gram in each spot, if any. The number of spots is a power of 2.
+
+	unsigned shift; //!< How far to shift a hash right to get a spot.
+
+	size_t count = 0; //!< The number of n-grams in the table.
+};
+
+
+/*! @class
+	@brief The 'ngrams' class declaration. */
+template <class Key>
+class ngrams
+{
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes an empty counter.
+
+	@param[in] num - The number of words to allocate space for.
+	@param[in] longest - The number of words in the longest n-grams to count,
+	                     from 2 to NGRAM_MAX.
+	**************************************************************************/
+	ngrams( const size_t num, const unsigned longest );
+
+	ngrams( const ngrams & ) = delete;
+	ngrams & operator = ( const ngrams & ) = delete;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function counts a block of words, and every n-gram that ends with
+	one of them, including the ones that start in the blocks before it.
+
+	@param[in] W - The words, in the order they're in in the text. Empty
+	               words are skipped.
+	@param[in] n - The number of words.
+	**************************************************************************/
+	void insertBatch( const std::string_view * const W, const size_t n );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the dictionary the words are counted in.
+
+	@returns dictionary<Key> & - The dictionary.
+	**************************************************************************/
+	dictionary<Key> & words() { return dict; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of words in the longest n-grams counted.
+
+	@returns unsigned - The number of words.
+	**************************************************************************/
+	unsigned longest() const { return most; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of n-grams of a length that were
+	counted, including copies.
+
+	@param[in] length - The number of words in each n-gram, from 2 to
+	                    longest().
+
+	@returns size_t - The number of n-grams.
+	**************************************************************************/
+	size_t total( const unsigned length ) const { return totals[length]; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of different n-grams of a length.
+
+	@param[in] length - The number of words in each n-gram, from 2 to
+	                    longest().
+
+	@returns size_t - The number of n-grams.
+	**************************************************************************/
+	size_t size( const unsigned length ) const { return length == 2 ? pairs.size() : triples.size(); }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints the n-grams of a length grouped by how often they
+	occur, from most to least, as a report, just like dictionary::print()
+	prints words. The words of each n-gram are separated by a space, and
+	n-grams with the same count are printed alphabetically.
+
+	@param[in] length - The number of words in each n-gram, from 2 to
+	                    longest().
+	@param[in,out] txt - The stream to print the n-grams to.
+	@param[in,out] csv - The stream to print the ranks and frequencies to.
+	**************************************************************************/
+	void print( const unsigned length, std::ostream & txt, std::ostream & csv ) const;
+
+
+	private:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints the n-grams in a table, like print().
+
+	@param[in] table - The table of n-grams.
+	@param[in,out] txt - The stream to print the n-grams to.
+	@param[in,out] csv - The stream to print the ranks and frequencies to.
+	**************************************************************************/
+	template <unsigned N>
+	void printTable( const gramtable<N> & table, std::ostream & txt, std::ostream & csv ) const;
+
+
+	dictionary<Key> dict; //!< The words, and their ids.
+
+	gramtable<2> pairs; //!< The n-grams of 2 words.
+
+	gramtable<3> triples; //!< The n-grams of 3 words, if they're counted.
+
+	unsigned most; //!< The number of words in the longest n-grams counted.
+
+	size_t totals[NGRAM_MAX + 1] = {}; //!< The number of n-grams of each length counted.
+
+	std::vector<uint32_t> ids; //!< The ids of the words of the block being counted.
+
+	uint32_t last[NGRAM_MAX - 1]; //!< The ids of the last words counted, the latest first.
+
+	unsigned run = 0; //!< How many of 'last' there are, up to NGRAM_MAX - 1.
+};
+
+
+#endif /* NGRAMS_H */
@@ -0,0 +1,103 @@
+#include "pipeline.h"
+
+
+// The number of blocks the reader can fill before the tokenizer catches up.
+// Each one is the size of a streamreader's buffer.
+#define PIPELINE_BLOCKS 4
+
+// The number of bytes tokenized at a time. Small enough that the lowercased
+// copy is still in cache when the counter gets to it, if the threads share a
+// cache.
+#define PIPELINE_PIECE ( 1 << 16 )
+
+// The number of pieces the tokenizer can get ahead of the counter.
+#define PIPELINE_PIECES 16
+
+
+pipeline::pipeline() : blocks( PIPELINE_BLOCKS ), pieces( PIPELINE_PIECES ),
+	empty( PIPELINE_BLOCKS ), full( PIPELINE_BLOCKS + 1 ), spare( PIPELINE_PIECES ), done( PIPELINE_PIECES + 1 )
+{
+	// The rings of full blocks and pieces have room for the nullptr at the
+	// end too, so no stage ever waits to say it's done.
+	for ( block & b : blocks ) empty.push( &b );
+	for ( piece & p : pieces ) spare.push( &p );
+}
+
+pipeline::~pipeline()
+{
+	// Neither thread can stop partway, so let them finish.
+	if ( splitter.joinable() ) while ( next() );
+}
+
+
+void pipeline::start( streamreader & in, const char * const first, const char * const last )
+{
+	this->in = &in;
+
+	reader = std::thread( [this]() { read(); } );
+	splitter = std::thread( [this, first, last]() { tokenize( first, last ); } );
+}
+
+const std::vector<std::string_view> * pipeline::next()
+{
+	if ( current ) spare.push( current );
+
+	current = done.pop();
+	if ( current ) return current->words;
+
+	reader.join();
+	splitter.join();
+
+	return nullptr;
+}
+
+
+void pipeline::read()
+{
+	while ( true )
+	{
+		block * const b = empty.pop();
+
+		// The last block is left out, since only the tokenizer may put
+		// blocks back in 'empty'.
+		if ( !in->read( b->text, b->length ) )
+		{
+			full.push( nullptr );
+
+			return;
+		}
+
+		full.push( b );
+	}
+}
+
+void pipeline::tokenize( const char * first, const char * const last )
+{
+	split( first, last );
+
+	while ( block * const b = full.pop() )
+	{
+		split( b->text.data(), b->text.data() + b->length );
+
+		// The words were copied by the tokenizers, so the block can be read
+		// into again.
+		empty.push( b );
+	}
+
+	done.push( nullptr );
+}
+
+void pipeline::split( const char * pos, const char * const end )
+{
+	while ( pos != end )
+	{
+		// Get the next piece, without splitting a word in two.
+		const char * const next = tokenizer::boundary( end - pos > PIPELINE_PIECE ? pos + PIPELINE_PIECE : end, end );
+
+		piece * const p = spare.pop();
+		p->words = &p->tok.tokenize( pos, next );
+		done.push( p );
+
+		pos = next;
+	}
+}
@@ -0,0 +1,166 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the pipeline class.
+
+A pipeline reads and tokenizes a stream on two threads of its own, while the
+thread that uses it does nothing but count the words, so the three stages
+overlap instead of taking turns:
+  reader     Reads large blocks of the stream with a streamreader.
+  tokenizer  Splits each block into pieces and tokenizes them, each with its
+             own tokenizer, so the words of a piece stay valid while the
+             next pieces are tokenized.
+  counter    Gets the words of one piece at a time from next().
+
+The stages are connected by rings, and the blocks and tokenizers are passed
+back along rings of their own once they're used, so only a fixed number of
+each ever exist. A stage that gets ahead waits for the one after it, so memory
+use doesn't depend on how fast the disk is compared to the CPU. While the
+counter is busy, the reader is already waiting on the disk for the next block,
+which hides the time spent reading on slow disks and network file systems.
+******************************************************************************/
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <cstddef>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "ring.h"
+#include "streamreader.h"
+#include "tokenizer.h"
+
+
+/*! @class
+	@brief The 'pipeline' class declaration. */
+class pipeline
+{
+	private:
+
+	/*! @struct
+		@brief The 'block' struct definition. Text read from the stream. */
+	struct block
+	{
+		std::vector<char> text; //!< The buffer the text is read into.
+
+		size_t length = 0; //!< The number of bytes of text.
+	};
+
+	/*! @struct
+		@brief The 'piece' struct definition. The words of part of a block. */
+	struct piece
+	{
+		tokenizer tok; //!< The tokenizer the words point into.
+
+		const std::vector<std::string_view> * words = nullptr; //!< The words.
+	};
+
+
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes a pipeline that isn't running yet.
+	**************************************************************************/
+	pipeline();
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function stops the pipeline, reading the rest of the stream if the
+	words weren't all taken with next().
+	**************************************************************************/
+	~pipeline();
+
+	pipeline( const pipeline & ) = delete;
+	pipeline & operator = ( const pipeline & ) = delete;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function starts reading and tokenizing a stream. The stream must not
+	be used by anything else until next() returns nullptr.
+
+	@param[in,out] in - The stream to read.
+	@param[in] first - The start of a block already read from the stream with
+	                   streamreader::read( first, last ), whose words come
+	                   first. It must stay valid until next() returns
+	                   nullptr.
+	@param[in] last - The end of the block.
+	**************************************************************************/
+	void start( streamreader & in, const char * const first, const char * const last );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function gets the words of the next piece of the stream. The words
+	of the last piece are no longer valid after this.
+
+	@returns const std::vector<std::string_view> * - The words, or nullptr
+	                                                 once every piece has
+	                                                 been returned.
+	**************************************************************************/
+	const std::vector<std::string_view> * next();
+
+
+	private:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function reads blocks until the end of the stream. It runs on the
+	reader thread.
+	**************************************************************************/
+	void read();
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function tokenizes the first block and then every block read, a
+	piece at a time. It runs on the tokenizer thread.
+
+	@param[in] first - The start of the first block.
+	@param[in] last - The end of the first block.
+	**************************************************************************/
+	void tokenize( const char * first, const char * const last );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function tokenizes the pieces of some text and passes them on.
+
+	@param[in] pos - The start of the text.
+	@param[in] end - The end of the text, which must be at a word boundary.
+	**************************************************************************/
+	void split( const char * pos, const char * const end );
+
+
+	streamreader * in = nullptr; //!< The stream being read.
+
+	std::vector<block> blocks; //!< Every block.
+
+	std::vector<piece> pieces; //!< Every piece.
+
+	ring<block *> empty; //!< Blocks ready to be read into.
+
+	ring<block *> full; //!< Blocks read, or nullptr at the end of the stream.
+
+	ring<piece *> spare; //!< Pieces ready to be tokenized into.
+
+	ring<piece *> done; //!< Pieces tokenized, or nullptr at the end of the stream.
+
+	piece * current = nullptr; //!< The piece returned by the last next().
+
+	std::thread reader; //!< The reader thread.
+
+	std::thread splitter; //!< The tokenizer thread.
+};
+
+
+#endif /* PIPELINE_H */
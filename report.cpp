@@ -0,0 +1,223 @@
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "keys.h"
+#include "report.h"
+
+
+// The number of characters to format before writing them to a file.
+#define REPORT_BUFFER ( 1 << 20 )
+
+// The most characters any one number can take.
+#define NUMBER_CHARS 32
+
+// How many words ahead of the one being printed to start loading.
+#define REPORT_AHEAD 16
+
+
+namespace
+{
+	/*! @struct
+		@brief Collects formatted text for a stream, and writes it out in
+		large blocks. */
+	struct buffer
+	{
+		std::ostream & out; //!< The stream to write to.
+
+		std::vector<char> text = std::vector<char>( REPORT_BUFFER ); //!< The text that hasn't been written yet.
+
+		size_t used = 0; //!< The number of characters of 'text' in use.
+
+		buffer( std::ostream & out ) : out( out ) {}
+
+		~buffer() { flush(); }
+
+		/*! @brief Writes the text. */
+		void flush() { out.write( text.data(), used ); used = 0; }
+
+		/*! @brief Returns room for 'n' more characters, writing the text
+			first if there isn't enough. */
+		char * room( const size_t n )
+		{
+			if ( used + n > text.size() )
+			{
+				flush();
+
+				if ( n > text.size() ) text.resize( n );
+			}
+
+			char * const pos = text.data() + used;
+			used += n;
+
+			return pos;
+		}
+
+		/*! @brief Adds a string. */
+		void add( const std::string_view str ) { memcpy( room( str.size() ), str.data(), str.size() ); }
+
+		/*! @brief Adds a string, padded with spaces on the left to 'width'. */
+		void right( const std::string_view str, const size_t width )
+		{
+			const size_t pad = ( str.size() < width ? width - str.size() : 0 );
+			char * const pos = room( pad + str.size() );
+
+			memset( pos, ' ', pad );
+			memcpy( pos + pad, str.data(), str.size() );
+		}
+
+		/*! @brief Adds a word, padded with spaces on the right to 'width'
+			columns. A character may take more than one byte, and in UTF-8,
+			no columns or two. */
+		void left( const std::string_view str, const size_t width )
+		{
+			const size_t length = alphabet::columns( str );
+			const size_t pad = ( length < width ? width - length : 0 );
+			char * const pos = room( str.size() + pad );
+
+			memcpy( pos, str.data(), str.size() );
+			memset( pos + str.size(), ' ', pad );
+		}
+	};
+
+	/*! @brief Formats an integer into 'digits'. */
+	std::string_view format( char * const digits, const size_t value )
+	{
+		return std::string_view( digits, std::to_chars( digits, digits + NUMBER_CHARS, value ).ptr - digits );
+	}
+
+	/*! @brief Formats a double into 'digits' the way a stream would, with
+		std::fixed and the given precision, or by default if 'fixed' is
+		false. */
+	std::string_view format( char * const digits, const double value, const bool fixed, const int precision )
+	{
+		const std::chars_format style = ( fixed ? std::chars_format::fixed : std::chars_format::general );
+
+		return std::string_view( digits, std::to_chars( digits, digits + NUMBER_CHARS, value, style, precision ).ptr - digits );
+	}
+
+	/*! @brief Adds the CSV row of 'count' words that occur 'frequency'
+		times, after the 'printed' words that occur more often, and adds
+		them to 'printed'. */
+	void row( buffer & out, size_t & printed, const size_t frequency, const size_t count )
+	{
+		char digits[NUMBER_CHARS];
+
+		// The average rank, as in writeText().
+		double avg = double( printed + 1 );
+		printed += count;
+		avg = avg + ( printed - avg ) / 2.0;
+
+		// Output CSV Info
+		out.add( "\n" );
+		out.add( format( digits, avg, false, 6 ) );
+		out.add( "," );
+		out.add( format( digits, frequency ) );
+		out.add( "," );
+		out.add( format( digits, avg * frequency, false, 6 ) );
+	}
+}
+
+
+report::report( std::ostream & txt, std::ostream * const csv, const size_t columns, const size_t width ) : txt( txt ), csv( csv ), columns( columns ), width( width )
+{
+}
+
+
+void report::add( const size_t frequency, const std::string_view * const words, const size_t count )
+{
+	groups.push_back( group{ frequency, words, count } );
+}
+
+void report::write() const
+{
+	if ( !csv )
+	{
+		writeText();
+
+		return;
+	}
+
+	// The CSV file is much smaller, so it gets the second thread.
+	std::thread other( [this]() { writeCSV(); } );
+
+	writeText();
+
+	other.join();
+}
+
+
+void report::writeText() const
+{
+	buffer out( txt );
+	char digits[NUMBER_CHARS], first[NUMBER_CHARS], last[NUMBER_CHARS];
+
+	// Headers
+	out.add( "Word Frequencies                             Ranks     Avg Rank\n"
+			 "----------------                             -----     --------" );
+
+	size_t printed = 0; // The number of words printed so far.
+
+	for ( const group & g : groups )
+	{
+		// Print the header for this frequency level.
+		const std::string_view frequency = format( digits, g.frequency );
+
+		out.add( "\n\nWords occuring " );
+		out.add( frequency );
+		out.add( g.frequency > 1 ? " times:" : " time:" );
+
+		// Convert the range of ranks covered by this frequency to a string,
+		// and calculate the average rank.
+		std::string ranks( format( first, printed + 1 ) );
+		double avg = double( printed + 1 );
+		if ( g.count > 1 )
+		{
+			ranks += '-';
+			ranks += format( last, printed + g.count );
+		}
+		printed += g.count;
+		avg = avg + ( printed - avg ) / 2.0;
+
+		// Print the range of ranks and the average rank.
+		out.right( ranks, 29 - frequency.size() - ( g.frequency > 1 ? 1 : 0 ) );
+		out.right( format( digits, avg, true, 1 ), 13 );
+
+		// Print the words that occur at this frequency level. They're in a
+		// different order in memory, so start loading them well before
+		// they're needed.
+		for ( size_t j = 0; j < g.count; ++j )
+		{
+			if ( j + REPORT_AHEAD < g.count ) PREFETCH( g.words[j+REPORT_AHEAD].data() );
+
+			if ( !( j % columns ) ) out.add( "\n" );
+			out.left( g.words[j], width );
+		}
+	}
+}
+
+void report::writeCSV() const
+{
+	buffer out( *csv );
+
+	// Headers
+	out.add( "Rank,Frequency,Rank x Frequency" );
+
+	size_t printed = 0; // The number of words printed so far.
+
+	for ( const group & g : groups ) row( out, printed, g.frequency, g.count );
+}
+
+void report::curve( std::ostream & csv, const std::vector<std::pair<size_t, size_t>> & groups )
+{
+	buffer out( csv );
+
+	// The same as writeCSV(), without any words.
+	out.add( "Rank,Frequency,Rank x Frequency" );
+
+	size_t printed = 0;
+
+	for ( const std::pair<size_t, size_t> & g : groups ) row( out, printed, g.first, g.second );
+}
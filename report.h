@@ -0,0 +1,248 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the report class.
+
+A report prints words grouped by how often they occur, from most to least, to
+a text file and a CSV file. Each group gets the range of ranks it covers and
+its average rank, and the CSV file gets one row of rank, frequency, and their
+product per group, which should be about the same for every group if the
+words follow Zipf's Law.
+
+Anything that counts words can print a report, as long as it can hand over
+its words one frequency at a time, most frequent first. The report only keeps
+pointers to the words, and formats everything itself into large buffers with
+std::to_chars rather than through the streams, so printing a big dictionary
+takes far less time than counting it did. The two files are written at the
+same time, on two threads. A report can also print only the text file, for
+something that prints its CSV file another way, such as from a histogram.
+******************************************************************************/
+
+#ifndef REPORT_H
+#define REPORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iosfwd>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "alphabets.h"
+
+
+// Counts below this are sorted by byCount() with a counting sort. Higher
+// counts are rare, and are sorted with a comparison sort instead, so the
+// counting sort never needs more than this many buckets.
+#define REPORT_DIRECT ( 1 << 16 )
+
+// The number of words on each line of the text file, and how many characters
+// each one is padded to, unless a report is given others.
+#define REPORT_COLUMNS 5
+#define REPORT_WIDTH 15
+
+
+/*! @class
+	@brief The 'report' class declaration. */
+class report
+{
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function starts an empty report.
+
+	@param[in,out] txt - The stream to print the words to.
+	@param[in,out] csv - The stream to print the ranks and frequencies to, or
+	                     nullptr to print only the text file.
+	@param[in] columns - The number of words on each line of the text file.
+	@param[in] width - The number of characters each word is padded to.
+	**************************************************************************/
+	report( std::ostream & txt, std::ostream * const csv, const size_t columns = REPORT_COLUMNS, const size_t width = REPORT_WIDTH );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds the words that occur a certain number of times.
+	Groups must be added from the highest frequency to the lowest. Nothing is
+	printed until write().
+
+	@param[in] frequency - The number of times each word occurs.
+	@param[in] words - The words, in the order to print them. They are not
+	                   copied, so they must stay valid until write().
+	@param[in] count - The number of words. Must not be 0.
+	**************************************************************************/
+	void add( const size_t frequency, const std::string_view * const words, const size_t count );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints the headers of the columns, and then every group,
+	to both streams at once, or only to the text file if there's no CSV
+	file.
+	**************************************************************************/
+	void write() const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints a report of the words in a list of spots, such as
+	a hash table, sorted by count with a counting sort. Words with the same
+	count are printed in the order of their spots, or alphabetically if the
+	alphabet is lossy, since lossy keys don't keep the spots in order. The
+	words are never copied, only pointed to.
+
+	@param[in,out] txt - The stream to print the words to.
+	@param[in,out] csv - The stream to print the ranks and frequencies to, or
+	                     nullptr to print only the text file.
+	@param[in] spots - The number of spots.
+	@param[in] countAt - A function that returns the count of the word in a
+	                     spot, or 0 if there is no word there.
+	@param[in] wordAt - A function that returns the word in a spot.
+	@param[in] columns - The number of words on each line of the text file.
+	@param[in] width - The number of characters each word is padded to.
+	**************************************************************************/
+	template <class CountAt, class WordAt>
+	static void byCount( std::ostream & txt, std::ostream * const csv, const size_t spots, CountAt countAt, WordAt wordAt, const size_t columns = REPORT_COLUMNS, const size_t width = REPORT_WIDTH );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints only the CSV file of a report, from how many words
+	occur each number of times, such as a histogram gives. It's the same as
+	what write() prints to the CSV file, and doesn't need the words.
+
+	@param[in,out] csv - The stream to print the ranks and frequencies to.
+	@param[in] groups - Each frequency and its number of words, from the
+	                    highest frequency to the lowest.
+	**************************************************************************/
+	static void curve( std::ostream & csv, const std::vector<std::pair<size_t, size_t>> & groups );
+
+
+	private:
+
+	/*! @struct
+		@brief The 'group' struct definition. */
+	struct group
+	{
+		size_t frequency; //!< The number of times each word occurs.
+
+		const std::string_view * words; //!< The words.
+
+		size_t count; //!< The number of words.
+	};
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints the groups to the text file.
+	**************************************************************************/
+	void writeText() const;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints the groups to the CSV file.
+	**************************************************************************/
+	void writeCSV() const;
+
+
+	std::ostream & txt; //!< The stream to print the words to.
+
+	std::ostream * csv; //!< The stream to print the ranks and frequencies to, or nullptr.
+
+	size_t columns; //!< The number of words on each line of the text file.
+
+	size_t width; //!< The number of characters each word is padded to.
+
+	std::vector<group> groups; //!< The groups, from the highest frequency to the lowest.
+};
+
+
+template <class CountAt, class WordAt>
+void report::byCount( std::ostream & txt, std::ostream * const csv, const size_t spots, CountAt countAt, WordAt wordAt, const size_t columns, const size_t width )
+{
+	// Only counts below REPORT_DIRECT get a bucket of their own; the few
+	// words with higher counts are sorted on their own.
+	std::vector<size_t> starts; // How many words have each count, then where they go.
+	std::vector<size_t> common; // The spots of the words with higher counts.
+	size_t words = 0;
+
+	for ( size_t i = 0; i < spots; ++i )
+	{
+		const size_t num = countAt( i );
+		if ( !num ) continue;
+
+		++words;
+
+		if ( num >= REPORT_DIRECT ) common.push_back( i );
+		else
+		{
+			if ( num >= starts.size() ) starts.resize( num + 1, 0 );
+			++starts[num];
+		}
+	}
+
+	std::stable_sort( common.begin(), common.end(), [&]( const size_t a, const size_t b ) { return countAt( a ) > countAt( b ); } );
+
+	// The words with higher counts go first, and then the rest, from the
+	// highest count down.
+	std::vector<std::string_view> order( words );
+	size_t next = common.size();
+	for ( size_t num = starts.size(); num-- > 1; )
+	{
+		const size_t n = starts[num];
+
+		starts[num] = next;
+		next += n;
+	}
+
+	for ( size_t j = 0; j < common.size(); ++j ) order[j] = wordAt( common[j] );
+
+	for ( size_t i = 0; i < spots; ++i )
+	{
+		const size_t num = countAt( i );
+		if ( num && num < REPORT_DIRECT ) order[starts[num]++] = wordAt( i );
+	}
+
+
+	// Print each run of words with the same count together.
+	report out( txt, csv, columns, width );
+
+	for ( size_t j = 0; j < common.size(); )
+	{
+		const size_t num = countAt( common[j] );
+
+		size_t k = j + 1;
+		while ( k < common.size() && countAt( common[k] ) == num ) ++k;
+
+		if ( alphabet::lossy ) std::sort( order.begin() + j, order.begin() + k );
+
+		out.add( num, &order[j], k - j );
+
+		j = k;
+	}
+
+	// Each count below REPORT_DIRECT now ends where the next lower one starts.
+	for ( size_t num = starts.size(), end = common.size(); num-- > 1; )
+	{
+		if ( starts[num] > end )
+		{
+			if ( alphabet::lossy ) std::sort( order.begin() + end, order.begin() + starts[num] );
+
+			out.add( num, &order[end], starts[num] - end );
+		}
+
+		end = starts[num];
+	}
+
+	out.write();
+}
+
+
+#endif /* REPORT_H */
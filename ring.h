@@ -0,0 +1,138 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the ring class.
+
+A ring is a bounded queue that passes values from one thread to exactly one
+other. It's a circular array with a head that only the reading thread moves
+and a tail that only the writing thread moves, so neither needs a lock or even
+a compare and swap; each only has to see the other's index. The two indexes are
+kept on separate cache lines, so the threads don't slow each other down by
+writing to the same line.
+
+A full ring makes the writer wait, and an empty one makes the reader wait, so a
+fast stage can never run more than a ring's worth ahead of a slow one. Waiting
+spins for a moment, since the other thread usually isn't far behind, and then
+sleeps a little at a time, so a stage stuck waiting on a slow disk doesn't keep
+a CPU busy.
+******************************************************************************/
+
+#ifndef RING_H
+#define RING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+
+// The number of times a ring checks for room or a value, yielding in between,
+// before it starts sleeping.
+#define RING_SPINS 64
+
+// How long a ring sleeps between checks once it's done spinning.
+#define RING_NAP std::chrono::microseconds( 50 )
+
+// The size of a cache line, which the indexes are aligned to.
+#define RING_LINE 64
+
+
+/*! @class
+	@brief The 'ring' class declaration. */
+template <class T>
+class ring
+{
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes an empty ring.
+
+	@param[in] size - The most values the ring holds at once. It's rounded up
+	                  to a power of 2.
+	**************************************************************************/
+	ring( const size_t size )
+	{
+		size_t n = 1;
+		while ( n < size ) n <<= 1;
+
+		values.resize( n );
+		mask = n - 1;
+	}
+
+	ring( const ring & ) = delete;
+	ring & operator = ( const ring & ) = delete;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds a value to the end of the ring, waiting for room if
+	it's full. Only one thread may push.
+
+	@param[in] value - The value to add.
+	**************************************************************************/
+	void push( const T value )
+	{
+		const size_t t = tail.load( std::memory_order_relaxed );
+
+		for ( unsigned spins = 0; t - head.load( std::memory_order_acquire ) > mask; ++spins ) wait( spins );
+
+		values[t & mask] = value;
+		tail.store( t + 1, std::memory_order_release );
+	}
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function takes the value at the front of the ring, waiting for one
+	if it's empty. Only one thread may pop.
+
+	@returns T - The value.
+	**************************************************************************/
+	T pop()
+	{
+		const size_t h = head.load( std::memory_order_relaxed );
+
+		for ( unsigned spins = 0; tail.load( std::memory_order_acquire ) == h; ++spins ) wait( spins );
+
+		const T value = values[h & mask];
+		head.store( h + 1, std::memory_order_release );
+
+		return value;
+	}
+
+
+	private:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function waits a little for the other thread, yielding at first and
+	then sleeping.
+
+	@param[in] spins - The number of times the caller has waited already.
+	**************************************************************************/
+	static void wait( const unsigned spins )
+	{
+		if ( spins < RING_SPINS ) std::this_thread::yield();
+		else std::this_thread::sleep_for( RING_NAP );
+	}
+
+
+	std::vector<T> values; //!< The values, at their index modulo the size.
+
+	size_t mask; //!< The size of 'values', minus 1.
+
+	alignas( RING_LINE ) std::atomic<size_t> head { 0 }; //!< The index of the next value to pop.
+
+	alignas( RING_LINE ) std::atomic<size_t> tail { 0 }; //!< The index of the next value to push.
+};
+
+
+#endif /* RING_H */
@@ -0,0 +1,379 @@
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include "report.h"
+#include "shareddictionary.h"
+
+
+// The 'gate' of a slot whose thread isn't inserting.
+#define IDLE ~uint64_t( 0 )
+
+// The fewest spots the table starts with for each thread. Every thread can
+// add one word after seeing that the table is under 75% full, so this keeps
+// the table from filling up before one of them starts a resize.
+#define SHARED_MIN_SPOTS 16
+
+// How many spots of the old table a thread claims at a time to move while
+// resizing.
+#define SHARED_MOVE_STEP 1024
+
+// Spreads keys out over the table, as dictionary.cpp's BATCH_MIX does.
+#define SHARED_MIX 0x9E3779B97F4A7C15ull
+
+// How many words ahead of the one being inserted to start loading the spot
+// of, as in dictionary::insertBatch().
+#define SHARED_AHEAD 8
+
+
+template <class Key>
+shareddictionary<Key>::table::table( const size_t num ) : capacity( num )
+{
+	// The ()'s zero every spot, so every tag starts empty.
+	tags = new std::atomic<uint64_t>[num]();
+	nums = new std::atomic<uint64_t>[num]();
+	words = new std::atomic<word *>[num]();
+}
+
+template <class Key>
+shareddictionary<Key>::table::~table()
+{
+	delete[] tags;
+	delete[] nums;
+	delete[] words;
+}
+
+
+template <class Key>
+shareddictionary<Key>::shareddictionary( const size_t num, const unsigned threads ) :
+	count( 0 ), gate( 0 ), moving( nullptr ), slots( new slot[threads ? threads : 1] ), threads( threads ? threads : 1 )
+{
+	list.store( new table( std::max( num, size_t( SHARED_MIN_SPOTS ) * this->threads ) ) );
+
+	for ( unsigned i = 0; i < this->threads; ++i ) slots[i].gate.store( IDLE );
+}
+
+template <class Key>
+shareddictionary<Key>::~shareddictionary()
+{
+	// The old tables were deleted as they were replaced, and the words are
+	// freed along with the slots' arenas.
+	delete list.load();
+}
+
+
+template <class Key>
+void shareddictionary<Key>::insertBatch( const unsigned id, const std::string_view * const W, const size_t n )
+{
+	slot & s = slots[id];
+
+	// Collect the different words of the batch, exactly as
+	// dictionary::insertBatch() does, before touching the shared table.
+	size_t spots = 1;
+	while ( spots < 2 * n ) spots <<= 1;
+	if ( s.seen.size() < spots ) s.seen.assign( spots, std::make_pair( uint32_t( 0 ), uint32_t( 0 ) ) );
+	spots = s.seen.size();
+
+	if ( !++s.batches )
+	{
+		std::fill( s.seen.begin(), s.seen.end(), std::make_pair( uint32_t( 0 ), uint32_t( 0 ) ) );
+		s.batches = 1;
+	}
+
+	s.batch.clear();
+
+	for ( size_t j = 0; j < n; ++j )
+	{
+		if ( W[j].empty() ) continue;
+
+		const BIN K = Key::pack( W[j] );
+		size_t h = size_t( mulhi( uint64_t( Key::top( K ) ) * SHARED_MIX, spots ) );
+
+		while ( true )
+		{
+			if ( s.seen[h].first != s.batches )
+			{
+				s.seen[h] = std::make_pair( s.batches, uint32_t( s.batch.size() ) );
+				s.batch.push_back( pending{ K, W[j], 1 } );
+
+				break;
+			}
+
+			pending & p = s.batch[s.seen[h].second];
+			if ( p.key == K && ( !Key::truncated( K ) || p.str == W[j] ) )
+			{
+				++p.num;
+
+				break;
+			}
+
+			if ( ++h == spots ) h = 0;
+		}
+	}
+
+	// Insert each different word once. Between words, check whether another
+	// thread has started a resize, and start one if the table is too full.
+	ready( s );
+	table * T = list.load( std::memory_order_acquire );
+
+	for ( size_t j = 0; j < s.batch.size(); ++j )
+	{
+		if ( gate.load( std::memory_order_acquire ) != s.gate.load( std::memory_order_relaxed ) )
+		{
+			ready( s );
+			T = list.load( std::memory_order_acquire );
+		}
+
+		while ( 4 * ( count.load() + 1 ) > 3 * T->capacity )
+		{
+			grow( s );
+			T = list.load( std::memory_order_acquire );
+		}
+
+		if ( j + SHARED_AHEAD < s.batch.size() ) PREFETCH( T->tags + home( s.batch[j+SHARED_AHEAD].key, T->capacity ) );
+
+		if ( add( *T, s, s.batch[j].key, s.batch[j].str, s.batch[j].num ) ) count.fetch_add( 1 );
+	}
+
+	// Everything this thread wrote to the table is seen by a resize that
+	// sees this.
+	s.gate.store( IDLE, std::memory_order_release );
+}
+
+template <class Key>
+size_t shareddictionary<Key>::find( const std::string_view str ) const
+{
+	if ( str.empty() ) return 0;
+
+	const table & T = *list.load();
+	const BIN K = Key::pack( str );
+	const uint64_t t = tag( K );
+
+	for ( size_t i = home( K, T.capacity ); T.tags[i].load(); i = ( i + 1 == T.capacity ? 0 : i + 1 ) )
+	{
+		if ( T.tags[i].load() != t ) continue;
+
+		const word * const w = T.words[i].load();
+		if ( w->key == K && ( !Key::truncated( K ) || w->str() == str ) ) return size_t( T.nums[i].load() );
+	}
+
+	return 0;
+}
+
+
+template <class Key>
+void shareddictionary<Key>::print( std::ostream & txt, std::ostream & csv ) const
+{
+	/*! @struct
+		@brief A word in the table, and its count. */
+	struct entry
+	{
+		BIN key; //!< The key of the word.
+
+		const word * w; //!< The word.
+
+		size_t num; //!< The count of the word.
+	};
+
+	const table & T = *list.load();
+
+	std::vector<entry> order;
+	order.reserve( count.load() );
+	for ( size_t i = 0; i < T.capacity; ++i )
+		if ( T.tags[i].load( std::memory_order_relaxed ) )
+		{
+			const word * const w = T.words[i].load( std::memory_order_relaxed );
+
+			order.push_back( entry{ w->key, w, size_t( T.nums[i].load( std::memory_order_relaxed ) ) } );
+		}
+
+	// Put the words in alphabetical order, which the dictionary keeps them
+	// in all along, so that words with the same count are printed in the
+	// same order it prints them.
+	std::sort( order.begin(), order.end(), []( const entry & a, const entry & b )
+	{
+		return ( a.key < b.key || ( a.key == b.key && Key::truncated( a.key ) && a.w->str() < b.w->str() ) );
+	} );
+
+	report::byCount( txt, &csv, order.size(),
+					 [&order]( const size_t j ) { return order[j].num; },
+					 [&order]( const size_t j ) { return order[j].w->str(); } );
+}
+
+
+template <class Key>
+size_t shareddictionary<Key>::home( const BIN K, const size_t capacity )
+{
+	// With 128 bit keys, the bottom half is mixed in too, since long words
+	// often share their first 12 characters.
+	uint64_t h = Key::top( K );
+	if ( Key::bits > 64 ) h ^= uint64_t( K ) * SHARED_MIX;
+
+	return size_t( mulhi( h * SHARED_MIX, capacity ) );
+}
+
+
+template <class Key>
+bool shareddictionary<Key>::add( table & T, slot & s, const BIN K, const std::string_view str, const size_t num )
+{
+	const uint64_t t = tag( K );
+
+	// With 64 bit keys, the tag is the whole key, so unless the word was cut
+	// off, a matching tag is this word and its word never has to be read.
+	const bool exact = ( Key::bits == 64 && !Key::truncated( K ) );
+
+	for ( size_t i = home( K, T.capacity ); ; i = ( i + 1 == T.capacity ? 0 : i + 1 ) )
+	{
+		uint64_t found = T.tags[i].load( std::memory_order_acquire );
+
+		// Claim an empty spot. If another thread claimed it first, see what
+		// it put there instead.
+		if ( !found && T.tags[i].compare_exchange_strong( found, t, std::memory_order_acq_rel ) )
+		{
+			word * const w = static_cast<word *>( s.words.allocate( sizeof( word ) + str.size(), alignof( word ) ) );
+			w->key = K;
+			w->length = uint32_t( str.size() );
+			memcpy( w + 1, str.data(), str.size() );
+
+			T.nums[i].fetch_add( num, std::memory_order_relaxed );
+			T.words[i].store( w, std::memory_order_release );
+
+			return true;
+		}
+
+		if ( found != t ) continue;
+
+		if ( !exact )
+		{
+			// The word is set right after the tag, so it won't be long.
+			const word * w;
+			while ( !( w = T.words[i].load( std::memory_order_acquire ) ) ) std::this_thread::yield();
+
+			if ( w->key != K || ( Key::truncated( K ) && w->str() != str ) ) continue;
+		}
+
+		T.nums[i].fetch_add( num, std::memory_order_relaxed );
+
+		return false;
+	}
+}
+
+template <class Key>
+void shareddictionary<Key>::place( table & T, word * const w, const uint64_t t, const uint64_t num )
+{
+	// Every word in the old table is different, so it only needs an empty
+	// spot, though other threads are placing words at the same time.
+	for ( size_t i = home( w->key, T.capacity ); ; i = ( i + 1 == T.capacity ? 0 : i + 1 ) )
+	{
+		uint64_t found = 0;
+		if ( T.tags[i].load( std::memory_order_relaxed ) || !T.tags[i].compare_exchange_strong( found, t, std::memory_order_relaxed ) ) continue;
+
+		T.nums[i].store( num, std::memory_order_relaxed );
+		T.words[i].store( w, std::memory_order_relaxed );
+
+		return;
+	}
+}
+
+
+template <class Key>
+void shareddictionary<Key>::ready( slot & s )
+{
+	while ( true )
+	{
+		const uint64_t g = gate.load();
+
+		// A resize started after this store will see it and wait, and one
+		// started before it is seen by the check below.
+		s.gate.store( g );
+
+		if ( g & 1 ) help( g, false );
+		else if ( gate.load() == g ) return;
+	}
+}
+
+template <class Key>
+void shareddictionary<Key>::grow( slot & s )
+{
+	uint64_t g = s.gate.load( std::memory_order_relaxed );
+
+	// If another thread started a resize first, help with it instead.
+	if ( gate.compare_exchange_strong( g, g + 1 ) )
+	{
+		s.gate.store( g + 1 );
+
+		help( g + 1, true );
+	}
+
+	ready( s );
+}
+
+template <class Key>
+void shareddictionary<Key>::help( const uint64_t g, const bool lead )
+{
+	move * m = nullptr;
+
+	if ( lead )
+	{
+		// Wait for every other inserting thread to finish its word and come
+		// help, so nothing is added to the old table while it's being moved.
+		for ( unsigned i = 0; i < threads; ++i )
+			while ( slots[i].gate.load() != IDLE && slots[i].gate.load() != g ) std::this_thread::yield();
+
+		table * const from = list.load();
+
+		moves.emplace_back( new move );
+		m = moves.back().get();
+		m->spots = from->capacity;
+		m->from = from;
+		m->to = new table( from->capacity * 2 );
+		m->claimed.store( 0 );
+		m->moved.store( 0 );
+
+		moving.store( m, std::memory_order_release );
+	}
+
+	else
+	{
+		// The next resize can't start until this thread leaves the gate, so
+		// if 'moving' is set, it's this resize's. If the gate has already
+		// moved on, this resize is over.
+		while ( gate.load( std::memory_order_acquire ) == g && !( m = moving.load( std::memory_order_acquire ) ) ) std::this_thread::yield();
+
+		if ( !m ) return;
+	}
+
+	// Move a chunk of the old table at a time, until every chunk is claimed.
+	for ( size_t first; ( first = m->claimed.fetch_add( SHARED_MOVE_STEP ) ) < m->spots; )
+	{
+		const size_t last = std::min( first + SHARED_MOVE_STEP, m->spots );
+
+		for ( size_t i = first; i < last; ++i )
+			if ( const uint64_t t = m->from->tags[i].load( std::memory_order_relaxed ) )
+				place( *m->to, m->from->words[i].load( std::memory_order_relaxed ), t, m->from->nums[i].load( std::memory_order_relaxed ) );
+
+		m->moved.fetch_add( last - first, std::memory_order_acq_rel );
+	}
+
+	if ( lead )
+	{
+		while ( m->moved.load( std::memory_order_acquire ) < m->spots ) std::this_thread::yield();
+
+		// Every other thread is done with the old table, and waiting on the
+		// gate, so it can be swapped out and freed.
+		list.store( m->to, std::memory_order_release );
+		delete m->from;
+
+		moving.store( nullptr );
+		gate.store( g + 1 );
+	}
+
+	else while ( gate.load( std::memory_order_acquire ) == g ) std::this_thread::yield();
+}
+
+
+// Both key types are compiled in, so the one to use can be picked at runtime.
+template class shareddictionary<key64>;
+#ifdef __SIZEOF_INT128__
+template class shareddictionary<key128>;
+#endif
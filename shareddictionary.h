@@ -0,0 +1,319 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the shareddictionary class.
+
+A shareddictionary counts words from many threads at once, in one table, so
+the vocabulary is only kept once instead of once per thread. Its table is
+stored as parallel arrays like the dictionary's, but every spot is atomic: a
+new word claims an empty spot by swapping its tag in with a compare and swap,
+and a word that is already there is counted with an atomic add, so threads
+never wait on each other to insert.
+
+Words can't be shifted over to keep them in alphabetical order while other
+threads are reading the table, so a word's spot is picked with a hash of its
+key instead, and words are only sorted when they are printed. Two words with
+the same count are still printed alphabetically, so the results are exactly
+the same as the dictionary's.
+
+When the table gets too full, the first thread to notice starts a resize.
+Every inserting thread stops at the end of the word it's on, and then all of
+them move the table to a new one twice as big together, a chunk of spots at a
+time, before they go on. A thread that isn't inserting at the time doesn't
+hold it up.
+
+Each thread that inserts must use its own slot, from 0 to the number of
+threads the dictionary was made for. A slot keeps the memory of the words its
+thread added, and what that thread is doing, so it needs no locks either.
+******************************************************************************/
+
+#ifndef SHAREDDICTIONARY_H
+#define SHAREDDICTIONARY_H
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "arena.h"
+#include "keys.h"
+
+
+/*! @class
+	@brief The 'shareddictionary' class declaration. */
+template <class Key>
+class shareddictionary
+{
+	private:
+
+	typedef typename Key::type BIN; //!< The integer type of a key.
+
+	/*! @struct
+		@brief The 'word' struct definition. Words are allocated from the arena
+		of the slot that added them, with the characters stored right after
+		the struct. */
+	struct word
+	{
+		BIN key; //!< The key of the word.
+
+		uint32_t length; //!< The number of characters in the word.
+
+		/*! @brief Returns the characters stored after this struct. */
+		std::string_view str() const { return std::string_view( reinterpret_cast<const char *>( this + 1 ), length ); }
+	};
+
+	/*! @struct
+		@brief The 'table' struct definition. A spot is empty until its tag is
+		set, and its word is set right after that. */
+	struct table
+	{
+		table( const size_t num );
+		~table();
+
+		table( const table & ) = delete;
+		table & operator = ( const table & ) = delete;
+
+		size_t capacity; //!< The number of spots in the table.
+
+		std::atomic<uint64_t> * tags; //!< The tag of the key in each spot, or 0 if it's empty.
+
+		std::atomic<uint64_t> * nums; //!< The count of the word in each spot.
+
+		std::atomic<word *> * words; //!< The word in each spot.
+	};
+
+	/*! @struct
+		@brief The 'move' struct definition. A resize in progress. */
+	struct move
+	{
+		size_t spots; //!< The number of spots in the old table.
+
+		const table * from; //!< The old table.
+
+		table * to; //!< The new table.
+
+		std::atomic<size_t> claimed; //!< The first spot of the old table no thread has started to move.
+
+		std::atomic<size_t> moved; //!< The number of spots of the old table that have been moved.
+	};
+
+	/*! @struct
+		@brief The 'pending' struct definition. A different word of a batch
+		being inserted, and how many times it occurs in the batch. */
+	struct pending
+	{
+		BIN key; //!< The key of the word.
+
+		std::string_view str; //!< The word.
+
+		size_t num; //!< The number of copies of the word in the batch.
+	};
+
+	/*! @struct
+		@brief The 'slot' struct definition. What one inserting thread uses. */
+	struct slot
+	{
+		std::atomic<uint64_t> gate; //!< The 'gate' this thread is inserting under, or all 1's if it isn't inserting.
+
+		arena words; //!< The memory of the words this thread added.
+
+		std::vector<pending> batch; //!< The different words of the batch being inserted.
+
+		std::vector<std::pair<uint32_t, uint32_t>> seen; //!< The batch's hash table, as in dictionary::insertBatch().
+
+		uint32_t batches = 0; //!< The number of batches inserted.
+	};
+
+
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes the dictionary.
+
+	@param[in] num - The number of words to allocate space for.
+	@param[in] threads - The number of threads that will insert at once.
+	**************************************************************************/
+	shareddictionary( const size_t num, const unsigned threads );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function deletes the dictionary.
+	**************************************************************************/
+	~shareddictionary();
+
+	shareddictionary( const shareddictionary & ) = delete;
+	shareddictionary & operator = ( const shareddictionary & ) = delete;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds a block of words to the dictionary. It can be called
+	by many threads at once, each with its own slot. Copies of the same word
+	within the block are counted together first, as in
+	dictionary::insertBatch().
+
+	@param[in] id - The slot of the calling thread.
+	@param[in] W - The words to add. Empty words are skipped.
+	@param[in] n - The number of words.
+	**************************************************************************/
+	void insertBatch( const unsigned id, const std::string_view * const W, const size_t n );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds a word in the dictionary. It must not be called while
+	any thread is inserting.
+
+	@param[in] str - The word to find.
+
+	@returns size_t - The number of copies of the word in the dictionary.
+	**************************************************************************/
+	size_t find( const std::string_view str ) const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of words in the dictionary.
+
+	@returns size_t - The number of words.
+	**************************************************************************/
+	size_t size() const { return count.load(); }
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints the words in the dictionary in the same format, and
+	the same order, as dictionary::print(). It must not be called while any
+	thread is inserting.
+
+	@param[in,out] txt - The stream to print the words to.
+	@param[in,out] csv - The stream to print the ranks and frequencies to.
+	**************************************************************************/
+	void print( std::ostream & txt, std::ostream & csv ) const;
+
+
+	private:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the tag of a key, which is never 0. With 64 bit
+	keys, it is the key itself, so two words with the same tag are the same
+	word unless the key was cut off.
+
+	@param[in] K - The key.
+
+	@returns uint64_t - The tag.
+	**************************************************************************/
+	static uint64_t tag( const BIN K ) { return Key::top( K ) | 1; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the spot a key should be in, spread evenly over the
+	table by a hash of the whole key.
+
+	@param[in] K - The key.
+	@param[in] capacity - The number of spots in the table.
+
+	@returns size_t - The spot.
+	**************************************************************************/
+	static size_t home( const BIN K, const size_t capacity );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds copies of a word to a table, claiming an empty spot
+	for it if it isn't there yet.
+
+	@param[in] T - The table.
+	@param[in] s - The slot of the calling thread.
+	@param[in] K - The key of the word.
+	@param[in] str - The word.
+	@param[in] num - The number of copies to add.
+
+	@returns bool - True if the word was new.
+	**************************************************************************/
+	bool add( table & T, slot & s, const BIN K, const std::string_view str, const size_t num );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function puts a word that was in another table into an empty spot
+	of a table, while moving the table.
+
+	@param[in,out] T - The table.
+	@param[in] w - The word.
+	@param[in] t - The tag of the word.
+	@param[in] num - The count of the word.
+	**************************************************************************/
+	static void place( table & T, word * const w, const uint64_t t, const uint64_t num );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function marks the calling thread as inserting under the current
+	'gate', helping with any resize in progress first, so that a resize
+	started after this returns will wait for it.
+
+	@param[in] s - The slot of the calling thread.
+	**************************************************************************/
+	void ready( slot & s );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function starts a resize, unless another thread already has, and
+	then helps with it.
+
+	@param[in] s - The slot of the calling thread.
+	**************************************************************************/
+	void grow( slot & s );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function stops inserting, helps move the table while a resize is
+	in progress, and returns once it is finished. The thread that started
+	the resize waits for every other inserting thread to stop, makes the new
+	table, and swaps it in at the end.
+
+	@param[in] g - The odd 'gate' of the resize, which the slot of the
+	               calling thread is already marked with.
+	@param[in] lead - True if the calling thread started the resize.
+	**************************************************************************/
+	void help( const uint64_t g, const bool lead );
+
+
+	std::atomic<table *> list; //!< The hash table.
+
+	std::atomic<size_t> count; //!< The number of words in the dictionary.
+
+	//! Even while the table is open for inserts, and odd while it is being
+	//! resized. It goes up by one at the start and end of every resize.
+	std::atomic<uint64_t> gate;
+
+	std::atomic<move *> moving; //!< The resize in progress, once its new table is ready.
+
+	std::vector<std::unique_ptr<move>> moves; //!< Every resize, kept so a late thread never touches freed memory.
+
+	std::unique_ptr<slot[]> slots; //!< The slot of each thread.
+
+	unsigned threads; //!< The number of slots.
+};
+
+
+#endif /* SHAREDDICTIONARY_H */
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include "keys.h"
+#include "sketch.h"
+
+
+// Scrambles the bits of a 64 bit number, so that every bit of the result
+// depends on every bit of X. This is the finalizer of SplitMix64.
+#define MIX( X ) ( ( X ) ^= ( X ) >> 30, ( X ) *= 0xBF58476D1CE4E5B9ull, \
+				   ( X ) ^= ( X ) >> 27, ( X ) *= 0x94D049BB133111EBull, \
+				   ( X ) ^= ( X ) >> 31 )
+
+
+sketch::sketch( const size_t width, const size_t depth, const size_t k ) :
+	cols( width ? width : 1 ), rows( depth ? depth : 1 ), cells( cols * rows, 0 ), seeds( rows ), heavy( k )
+{
+	// Every row gets its own odd multiplier, from a fixed sequence, so two
+	// sketches of the same size can be merged.
+	uint64_t seed = 0;
+	for ( uint64_t & s : seeds )
+	{
+		seed += 0x9E3779B97F4A7C15ull;
+
+		s = seed; MIX( s ); s |= 1;
+	}
+}
+
+
+void sketch::insert( const std::string_view str, const size_t num )
+{
+	if ( str.empty() ) return;
+
+	total += num;
+
+	// A candidate is counted exactly, without touching the sketch.
+	if ( heavy.add( str, num ) ) return;
+
+	const uint64_t h = hash( str );
+	const size_t count = update( h, num );
+
+	// If its count is now higher than the lowest candidate's, it becomes a
+	// candidate, and the word it replaces goes back into the sketch.
+	if ( count > heavy.bound() )
+	{
+		std::string evicted;
+
+		const size_t low = heavy.offer( str, count, evicted );
+		if ( low ) raise( hash( evicted ), low );
+	}
+}
+
+size_t sketch::find( const std::string_view str ) const
+{
+	const size_t num = heavy.find( str );
+
+	return ( num ? num : estimate( hash( str ) ) );
+}
+
+
+void sketch::merge( sketch & other )
+{
+	// Make each sketch cover every word it has counted, then add them.
+	flush();
+	other.flush();
+
+	for ( size_t i = 0; i < cells.size(); ++i )
+		cells[i] = uint32_t( std::min<uint64_t>( uint64_t( cells[i] ) + other.cells[i], UINT32_MAX ) );
+
+	total += other.total;
+
+	// The candidates of both, copied since clearing frees their strings.
+	std::vector<std::string> words;
+	words.reserve( heavy.size() + other.heavy.size() );
+	heavy.forEach( [&]( const std::string_view str, size_t ) { words.emplace_back( str ); } );
+	other.heavy.forEach( [&]( const std::string_view str, size_t ) { if ( !heavy.find( str ) ) words.emplace_back( str ); } );
+
+	heavy.clear();
+
+	// Count them again from the merged sketch. Their counts are already in
+	// it, so the ones that don't make it need nothing put back.
+	std::string evicted;
+	for ( const std::string & str : words ) heavy.offer( str, estimate( hash( str ) ), evicted );
+
+	other.heavy.clear();
+	std::fill( other.cells.begin(), other.cells.end(), 0 );
+	other.total = 0;
+}
+
+
+size_t sketch::bound() const
+{
+	return size_t( std::ceil( std::exp( 1.0 ) * double( total ) / double( cols ) ) );
+}
+
+double sketch::confidence() const
+{
+	return 1.0 - std::exp( -double( rows ) );
+}
+
+
+uint64_t sketch::hash( const std::string_view str )
+{
+	uint64_t h = 0x9E3779B97F4A7C15ull ^ str.size();
+
+	// Mix in 8 characters at a time, then whatever is left over.
+	size_t i = 0;
+	for ( ; i + 8 <= str.size(); i += 8 )
+	{
+		uint64_t chunk;
+		memcpy( &chunk, str.data() + i, 8 );
+
+		h ^= chunk; MIX( h );
+	}
+
+	if ( i < str.size() )
+	{
+		uint64_t chunk = 0;
+		memcpy( &chunk, str.data() + i, str.size() - i );
+
+		h ^= chunk; MIX( h );
+	}
+
+	return h;
+}
+
+size_t sketch::at( const uint64_t h, const size_t row ) const
+{
+	// Multiply-shift: the high bits of the hash times the row's multiplier
+	// pick the counter, so each row hashes the word differently. Deriving the
+	// rows from two halves of one hash instead lets a rare word share every
+	// counter with a common one.
+	return row * cols + size_t( mulhi( h * seeds[row], cols ) );
+}
+
+
+size_t sketch::estimate( const uint64_t h ) const
+{
+	uint32_t low = UINT32_MAX;
+	for ( size_t r = 0; r < rows; ++r ) low = std::min( low, cells[at( h, r )] );
+
+	return low;
+}
+
+size_t sketch::update( const uint64_t h, const size_t num )
+{
+	const size_t count = std::min<size_t>( estimate( h ) + num, UINT32_MAX );
+
+	raise( h, count );
+
+	return count;
+}
+
+void sketch::raise( const uint64_t h, const size_t num )
+{
+	const uint32_t count = uint32_t( std::min<size_t>( num, UINT32_MAX ) );
+
+	for ( size_t r = 0; r < rows; ++r )
+	{
+		uint32_t & cell = cells[at( h, r )];
+
+		if ( cell < count ) cell = count;
+	}
+}
+
+void sketch::flush()
+{
+	heavy.forEach( [&]( const std::string_view str, const size_t num ) { raise( hash( str ), num ); } );
+}
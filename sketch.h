@@ -0,0 +1,253 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the sketch class.
+
+A sketch counts words approximately in a fixed amount of memory, with a
+Count-Min sketch: D rows of W counters each, where every word hashes to one
+counter per row. A word's count is the lowest of its D counters, since other
+words can only have added to them. Counters are raised with conservative
+update: only the ones below the word's new count are raised, and only to that
+count, which keeps the counts lower than adding to all of them would.
+
+A sketch doesn't keep the words themselves, so it also has a small topk of
+candidate heavy words. A word enters it once its count from the sketch is
+higher than the lowest count in it, and from then on is counted exactly there
+instead of in the sketch. A word that gets pushed out puts its count back into
+the sketch, so no count is ever too low.
+
+Counts can only be too high, and with probability 1 - e^-D, no count is more
+than e / W * N too high, where N is the total number of words. Memory use only
+depends on W, D, and the number of candidates.
+******************************************************************************/
+
+#ifndef SKETCH_H
+#define SKETCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+#include "topk.h"
+
+
+/*! @class
+	@brief The 'sketch' class declaration. */
+class sketch
+{
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes an empty sketch.
+
+	@param[in] width - The number of counters in each row. Must be at least 1.
+	@param[in] depth - The number of rows. Must be at least 1.
+	@param[in] k - The number of candidate heavy words to keep.
+	**************************************************************************/
+	sketch( const size_t width, const size_t depth, const size_t k );
+
+	sketch( const sketch & ) = delete;
+	sketch & operator = ( const sketch & ) = delete;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function counts copies of a word.
+
+	@param[in] str - The word to count.
+	@param[in] num - The number of copies of the word.
+	**************************************************************************/
+	void insert( const std::string_view str, const size_t num = 1 );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the count of a word, from the candidates if it is
+	one, and otherwise from the sketch.
+
+	@param[in] str - The word to find.
+
+	@returns size_t - The count of the word, which may be too high by up to
+	                  bound() with probability confidence().
+	**************************************************************************/
+	size_t find( const std::string_view str ) const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds the counts of another sketch of the same width and
+	depth to this one. Every candidate's count is put back into its sketch,
+	the counters are added together, and then the candidates of both are
+	counted again from the merged sketch, keeping the K highest. The other
+	sketch is left empty.
+
+	@param[in,out] other - The sketch to merge into this one.
+	**************************************************************************/
+	void merge( sketch & other );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of counters in each row.
+
+	@returns size_t - W.
+	**************************************************************************/
+	size_t width() const { return cols; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of rows.
+
+	@returns size_t - D.
+	**************************************************************************/
+	size_t depth() const { return rows; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of candidate heavy words it can keep.
+
+	@returns size_t - K.
+	**************************************************************************/
+	size_t capacity() const { return heavy.capacity(); }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of candidate heavy words.
+
+	@returns size_t - The number of words that will be printed.
+	**************************************************************************/
+	size_t size() const { return heavy.size(); }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the most any count should be too high by, which is
+	e / W times the number of words counted.
+
+	@returns size_t - The largest likely error of any count.
+	**************************************************************************/
+	size_t bound() const;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the probability that no count is more than
+	bound() too high, which is 1 - e^-D.
+
+	@returns double - The probability.
+	**************************************************************************/
+	double confidence() const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints the candidate heavy words in the same format as
+	dictionary::print().
+
+	@param[in,out] txt - The stream to print the words to.
+	@param[in,out] csv - The stream to print the ranks and frequencies to.
+	**************************************************************************/
+	void print( std::ostream & txt, std::ostream & csv ) const { heavy.print( txt, csv ); }
+
+
+	private:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function hashes a word into 64 bits. Each row picks its counter by
+	multiplying the hash by a different number.
+
+	@param[in] str - The word to hash.
+
+	@returns uint64_t - The hash.
+	**************************************************************************/
+	static uint64_t hash( const std::string_view str );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the counter of a hash in a row.
+
+	@param[in] h - The hash of the word.
+	@param[in] row - The row.
+
+	@returns size_t - The index of the counter in 'cells'.
+	**************************************************************************/
+	size_t at( const uint64_t h, const size_t row ) const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the count of a word from the sketch alone, which is
+	the lowest of its counters.
+
+	@param[in] h - The hash of the word.
+
+	@returns size_t - The count.
+	**************************************************************************/
+	size_t estimate( const uint64_t h ) const;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds copies of a word to the sketch with conservative
+	update: its count goes up by 'num', and only counters lower than the new
+	count are raised, to the new count.
+
+	@param[in] h - The hash of the word.
+	@param[in] num - The number of copies of the word.
+
+	@returns size_t - The new count of the word.
+	**************************************************************************/
+	size_t update( const uint64_t h, const size_t num );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function raises every counter of a word to at least a count, so its
+	count from the sketch is at least that high.
+
+	@param[in] h - The hash of the word.
+	@param[in] num - The count.
+	**************************************************************************/
+	void raise( const uint64_t h, const size_t num );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function puts the count of every candidate back into the sketch.
+	**************************************************************************/
+	void flush();
+
+
+	size_t cols; //!< The number of counters in each row.
+
+	size_t rows; //!< The number of rows.
+
+	size_t total = 0; //!< The number of words counted.
+
+	std::vector<uint32_t> cells; //!< The counters, one row after another. They stop at UINT32_MAX.
+
+	std::vector<uint64_t> seeds; //!< The multiplier each row hashes words with.
+
+	topk heavy; //!< The candidate heavy words, counted exactly since they became candidates.
+};
+
+
+#endif /* SKETCH_H */
@@ -0,0 +1,419 @@
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include "report.h"
+#include "snapshot.h"
+
+
+// The key stored in an empty spot, as in dictionary.cpp.
+#define EMPTY BIN( ~BIN( 0 ) )
+
+// The spot in the table that key K points to.
+#define HOME( K ) size_t( mulhi( Key::top( K ), Key::scale( size_t( head->capacity ) ) ) )
+
+// How many values of each part of a snapshot merge() collects before writing
+// them.
+#define MERGE_BLOCK 4096
+
+
+namespace
+{
+	/*! @struct
+		@brief Collects the values of one part of a snapshot, and writes them
+		to where that part goes in the file, a block at a time. */
+	template <class T>
+	struct part
+	{
+		std::ostream & out; //!< The stream to write to.
+
+		uint64_t pos; //!< Where in the stream the next block goes.
+
+		std::vector<T> block; //!< The values that haven't been written yet.
+
+		part( std::ostream & out, const uint64_t pos ) : out( out ), pos( pos ) { block.reserve( MERGE_BLOCK ); }
+
+		/*! @brief Writes the values. */
+		void flush()
+		{
+			out.seekp( std::streamoff( pos ) );
+			out.write( reinterpret_cast<const char *>( block.data() ), std::streamsize( block.size() * sizeof( T ) ) );
+
+			pos += block.size() * sizeof( T );
+			block.clear();
+		}
+
+		/*! @brief Adds values. */
+		void add( const T * const values, const size_t n )
+		{
+			block.insert( block.end(), values, values + n );
+
+			if ( block.size() >= MERGE_BLOCK ) flush();
+		}
+
+		/*! @brief Adds a value. */
+		void add( const T value ) { add( &value, 1 ); }
+	};
+}
+
+
+unsigned snapshotKeyBits( const char * const data, const size_t size )
+{
+	if ( size < sizeof( snapshotheader ) ) return 0;
+
+	const snapshotheader * const head = reinterpret_cast<const snapshotheader *>( data );
+
+	if ( memcmp( head->magic, SNAPSHOT_MAGIC, sizeof( head->magic ) ) || head->version != SNAPSHOT_VERSION ) return 0;
+
+	return head->keyBits;
+}
+
+
+template <class Key>
+bool snapshot<Key>::open( const char * const data, const size_t size )
+{
+	if ( snapshotKeyBits( data, size ) != Key::bits ) return false;
+
+	const snapshotheader * const h = reinterpret_cast<const snapshotheader *>( data );
+
+	// Every part has to be in the file, in order, aligned, and big enough for
+	// the table, so that nothing can be read past the end of it.
+	const uint64_t spots = h->capacity;
+	if ( !spots || h->end != size || h->words > spots ) return false;
+	if ( h->keys < sizeof( snapshotheader ) || h->keys % alignof( BIN ) ) return false;
+	if ( h->counts < h->keys || ( h->counts - h->keys ) / sizeof( BIN ) < spots + 1 || h->counts % alignof( uint64_t ) ) return false;
+	if ( h->offsets < h->counts || ( h->offsets - h->counts ) / sizeof( uint64_t ) < spots || h->offsets % alignof( uint64_t ) ) return false;
+	if ( h->pool < h->offsets || ( h->pool - h->offsets ) / sizeof( uint64_t ) < spots + 1 || h->pool > size ) return false;
+
+	// The table has to end with an empty spot, so probes stop.
+	const uint64_t * const o = reinterpret_cast<const uint64_t *>( data + h->offsets );
+	const BIN * const k = reinterpret_cast<const BIN *>( data + h->keys );
+	if ( k[spots] != EMPTY || o[0] || o[spots] > size - h->pool ) return false;
+
+	// Each word has to be in the pool, so the offsets can't go backwards, and
+	// only the spots with words can have counts. The words and counts have to
+	// add up to the header's, or a damaged count would be trusted by
+	// everything that reads them. Each key has to be its word's, in order,
+	// and no earlier than its home spot, or a probe would miss it.
+	const uint64_t * const c = reinterpret_cast<const uint64_t *>( data + h->counts );
+	const char * const p = data + h->pool;
+	uint64_t words = 0, total = 0;
+	BIN last = 0;
+	for ( uint64_t i = 0; i < spots; ++i )
+	{
+		if ( o[i] > o[i+1] ) return false;
+
+		if ( k[i] == EMPTY )
+		{
+			if ( c[i] || o[i] != o[i+1] ) return false;
+
+			continue;
+		}
+
+		if ( !c[i] || o[i] == o[i+1] || total + c[i] < total ) return false;
+
+		const std::string_view word( p + o[i], size_t( o[i+1] - o[i] ) );
+		if ( k[i] < last || Key::pack( word ) != k[i] || mulhi( Key::top( k[i] ), Key::scale( size_t( spots ) ) ) > i ) return false;
+
+		last = k[i];
+		++words;
+		total += c[i];
+	}
+
+	if ( words != h->words || total != h->total ) return false;
+
+	head = h;
+	keys = k;
+	counts = c;
+	offsets = o;
+	pool = p;
+
+	return true;
+}
+
+
+template <class Key>
+size_t snapshot<Key>::find( const std::string_view str ) const
+{
+	if ( str.empty() ) return 0;
+
+	const BIN K = Key::pack( str );
+	const size_t i = locate( K, str );
+
+	if ( keys[i] == K && ( !Key::truncated( K ) || word( i ) == str ) ) return count( i );
+
+	return 0;
+}
+
+template <class Key>
+size_t snapshot<Key>::prefix( const std::string_view pre, std::vector<std::pair<std::string_view, size_t>> & found ) const
+{
+	const size_t before = found.size();
+
+	// The same as dictionary::prefix(), but reading the snapshot.
+	const size_t length = std::min( Key::length( pre ), size_t( Key::chars ) );
+	const BIN K = ( length ? BIN( Key::pack( pre ) & ~Key::flag ) : BIN( 0 ) );
+	const BIN span = ( length ? Key::span( length ) : BIN( 0 ) );
+	const bool cut = ( Key::length( pre ) > Key::chars || Key::lossy );
+
+	for ( size_t i = ( length ? locate( K, pre ) : 0 ); i < head->capacity; ++i )
+	{
+		if ( keys[i] == EMPTY ) continue;
+
+		if ( length && keys[i] - K >= span ) break;
+		if ( cut && word( i ).compare( 0, pre.size(), pre ) )
+		{
+			if ( Key::lossy ) continue;
+
+			break;
+		}
+
+		found.emplace_back( word( i ), count( i ) );
+	}
+
+	if ( Key::lossy ) std::sort( found.begin() + before, found.end() );
+
+	return found.size() - before;
+}
+
+template <class Key>
+size_t snapshot<Key>::range( const std::string_view low, const std::string_view high, std::vector<std::pair<std::string_view, size_t>> & found ) const
+{
+	const size_t before = found.size();
+
+	// The same as dictionary::range(), but reading the snapshot.
+	if ( Key::lossy )
+	{
+		for ( size_t i = 0; i < head->capacity; ++i )
+		{
+			if ( keys[i] == EMPTY ) continue;
+
+			const std::string_view str = word( i );
+
+			if ( str >= low && ( high.empty() || str <= high ) ) found.emplace_back( str, count( i ) );
+		}
+
+		std::sort( found.begin() + before, found.end() );
+
+		return found.size() - before;
+	}
+
+	const BIN H = ( high.empty() ? EMPTY : Key::pack( high ) );
+
+	for ( size_t i = ( low.empty() ? 0 : locate( Key::pack( low ), low ) ); i < head->capacity; ++i )
+	{
+		if ( keys[i] == EMPTY ) continue;
+
+		if ( keys[i] > H || ( keys[i] == H && Key::truncated( H ) && word( i ) > high ) ) break;
+
+		found.emplace_back( word( i ), count( i ) );
+	}
+
+	return found.size() - before;
+}
+
+
+template <class Key>
+void snapshot<Key>::print( std::ostream & txt, std::ostream & csv ) const
+{
+	report::byCount( txt, &csv, size_t( head->capacity ),
+					 [this]( const size_t i ) { return count( i ); },
+					 [this]( const size_t i ) { return word( i ); } );
+}
+
+
+template <class Key>
+snapshotheader snapshot<Key>::layout( const uint64_t capacity, const uint64_t words, const uint64_t total, const uint64_t chars )
+{
+	snapshotheader head = {};
+	memcpy( head.magic, SNAPSHOT_MAGIC, sizeof( head.magic ) );
+	head.version = SNAPSHOT_VERSION;
+	head.keyBits = Key::bits;
+	head.capacity = capacity;
+	head.words = words;
+	head.total = total;
+
+	// Each part follows the one before it.
+	head.keys = sizeof( snapshotheader );
+	head.counts = head.keys + ( capacity + 1 ) * sizeof( BIN );
+	head.offsets = head.counts + capacity * sizeof( uint64_t );
+	head.pool = head.offsets + ( capacity + 1 ) * sizeof( uint64_t );
+	head.end = head.pool + chars;
+
+	return head;
+}
+
+template <class Key>
+bool snapshot<Key>::merge( const std::vector<snapshot> & parts, std::ostream & out )
+{
+	// First count the words, so the table can be sized for them.
+	uint64_t words = 0, total = 0, chars = 0;
+	combine( parts, [&]( BIN, const std::string_view str, const uint64_t num )
+	{
+		++words;
+		total += num;
+		chars += str.size();
+
+		return true;
+	} );
+
+	// Pick a capacity that keeps the table under 75% full, as
+	// dictionary::merge() does.
+	uint64_t capacity = 0;
+	for ( const snapshot & s : parts ) capacity = std::max( capacity, uint64_t( s.capacity() ) );
+	while ( 4 * words > 3 * capacity ) capacity <<= 1;
+
+	// Lay the words out in the table, each at its key's spot or right after
+	// the word before it. If the end of the table overflows, start over with
+	// a bigger one.
+	while ( true )
+	{
+		const snapshotheader h = layout( capacity, words, total, chars );
+		const uint64_t scale = Key::scale( size_t( capacity ) );
+
+		part<BIN> keys( out, h.keys );
+		part<uint64_t> counts( out, h.counts ), offsets( out, h.offsets );
+		part<char> pool( out, h.pool );
+
+		uint64_t next = 0, offset = 0;
+
+		// Adds empty spots up to spot 'i'.
+		const auto skip = [&]( const uint64_t i )
+		{
+			for ( ; next < i; ++next )
+			{
+				keys.add( EMPTY );
+				counts.add( 0 );
+				offsets.add( offset );
+			}
+		};
+
+		const bool fit = combine( parts, [&]( const BIN K, const std::string_view str, const uint64_t num )
+		{
+			skip( std::max( next, uint64_t( mulhi( Key::top( K ), scale ) ) ) );
+
+			if ( next == capacity ) return false;
+
+			keys.add( K );
+			counts.add( num );
+			offsets.add( offset );
+			pool.add( str.data(), str.size() );
+
+			offset += str.size();
+			++next;
+
+			return true;
+		} );
+
+		if ( !fit )
+		{
+			capacity <<= 1;
+
+			continue;
+		}
+
+		// The rest of the table is empty, and then comes the sentinel.
+		skip( capacity );
+		keys.add( EMPTY );
+		offsets.add( offset );
+
+		out.seekp( 0 );
+		out.write( reinterpret_cast<const char *>( &h ), sizeof( h ) );
+
+		keys.flush();
+		counts.flush();
+		offsets.flush();
+		pool.flush();
+
+		return bool( out );
+	}
+}
+
+
+template <class Key>
+size_t snapshot<Key>::locate( const BIN K, const std::string_view str ) const
+{
+	// As in dictionary::locate(). The EMPTY sentinel stops the probe.
+	size_t i = HOME( K );
+
+	while ( keys[i] < K ) ++i;
+
+	while ( keys[i] == K && Key::truncated( K ) && word( i ) < str ) ++i;
+
+	return i;
+}
+
+template <class Key>
+template <class Visit>
+bool snapshot<Key>::combine( const std::vector<snapshot> & parts, Visit visit )
+{
+	// The next word of each snapshot that has words left, kept in a heap with
+	// the first word alphabetically on top.
+	struct cursor
+	{
+		const snapshot * snap; //!< The snapshot.
+
+		size_t i; //!< The spot of its next word.
+
+		BIN key; //!< The key of the word.
+
+		std::string_view str; //!< The word.
+	};
+
+	// Moves a cursor to its snapshot's next word, or returns false if there
+	// isn't one.
+	const auto advance = []( cursor & c )
+	{
+		while ( c.i < c.snap->capacity() && c.snap->key( c.i ) == EMPTY ) ++c.i;
+		if ( c.i == c.snap->capacity() ) return false;
+
+		c.key = c.snap->key( c.i );
+		c.str = c.snap->word( c.i );
+
+		return true;
+	};
+
+	// Comes after, so that the heap puts the first word on top.
+	const auto after = []( const cursor & a, const cursor & b )
+	{
+		return ( a.key > b.key || ( a.key == b.key && Key::truncated( a.key ) && a.str > b.str ) );
+	};
+
+	std::vector<cursor> heap;
+	for ( const snapshot & s : parts )
+	{
+		cursor c = { &s, 0, EMPTY, std::string_view() };
+		if ( advance( c ) ) heap.push_back( c );
+	}
+	std::make_heap( heap.begin(), heap.end(), after );
+
+	while ( !heap.empty() )
+	{
+		const BIN K = heap.front().key;
+		const std::string_view str = heap.front().str;
+
+		// Every snapshot that has the first word comes to the top in turn, so
+		// take them off and add up their counts.
+		uint64_t num = 0;
+		while ( heap.size() && heap.front().key == K && ( !Key::truncated( K ) || heap.front().str == str ) )
+		{
+			std::pop_heap( heap.begin(), heap.end(), after );
+
+			cursor & c = heap.back();
+			num += c.snap->count( c.i++ );
+
+			if ( advance( c ) ) std::push_heap( heap.begin(), heap.end(), after );
+			else heap.pop_back();
+		}
+
+		if ( !visit( K, str, num ) ) return false;
+	}
+
+	return true;
+}
+
+
+// Both key types are compiled in, so the one to use can be picked at runtime.
+template class snapshot<key64>;
+#ifdef __SIZEOF_INT128__
+template class snapshot<key128>;
+#endif
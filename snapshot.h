@@ -0,0 +1,329 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the snapshot file format and the snapshot class.
+
+A snapshot is a dictionary saved to a file by dictionary::save(), laid out so
+that it can be memory mapped and searched where it is, with no parsing. It
+keeps the dictionary's table exactly as it was, with its empty spots, so a
+word is found the same way the dictionary finds it: by jumping to the spot
+its key points to. The file is:
+  Part                 Type                  Count
+  header               snapshotheader        1
+  keys                 Key::type             capacity + 1
+  counts               uint64_t              capacity
+  offsets              uint64_t              capacity + 1
+  pool                 char                  offsets[capacity]
+
+The last key is an EMPTY sentinel, like the dictionary's. A spot's word is
+pool[offsets[i]] up to pool[offsets[i+1]], and an empty spot has a count of 0.
+Everything is in the byte order of the machine that wrote it; a snapshot from
+a machine with the other byte order won't have a matching version, so it is
+rejected rather than misread.
+
+A snapshot can also be loaded back into a dictionary with dictionary::load(),
+which copies the table instead of rebuilding it, so more words can be counted
+into it.
+
+Since the words in every snapshot are in alphabetical order, any number of
+snapshots can be merged into one by reading them all from start to end at the
+same time, like the merge step of a merge sort. Only one word of each is held
+at a time, and the merged snapshot is written out in blocks as it is made, so
+merging takes almost no memory, no matter how big the snapshots are.
+******************************************************************************/
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "keys.h"
+
+
+// The first 8 bytes of every snapshot.
+#define SNAPSHOT_MAGIC "ZIPFSNAP"
+
+// The version of the format. Change this whenever the layout, or the way keys
+// are packed or placed in the table, changes. The alphabet is in the high
+// bits, since keys packed in one mean nothing in another.
+#define SNAPSHOT_VERSION ( 1 | alphabet::id << 16 )
+
+
+/*! @struct
+	@brief The 'snapshotheader' struct definition. Offsets are in bytes from
+	the start of the file. */
+struct snapshotheader
+{
+	char magic[8]; //!< SNAPSHOT_MAGIC, without its null.
+
+	uint32_t version; //!< SNAPSHOT_VERSION.
+
+	uint32_t keyBits; //!< The number of bits in a key.
+
+	uint64_t capacity; //!< The number of spots in the table.
+
+	uint64_t words; //!< The number of words in the table.
+
+	uint64_t total; //!< The total of every count.
+
+	uint64_t keys; //!< The offset of the keys.
+
+	uint64_t counts; //!< The offset of the counts.
+
+	uint64_t offsets; //!< The offset of the offsets of the words in the pool.
+
+	uint64_t pool; //!< The offset of the pool of words.
+
+	uint64_t end; //!< The size of the file.
+};
+
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function checks if a block of memory holds a snapshot, and returns the
+size of its keys.
+
+@param[in] data - The start of the block.
+@param[in] size - The size of the block.
+
+@returns unsigned - The number of bits in a key, or 0 if it isn't a snapshot.
+******************************************************************************/
+unsigned snapshotKeyBits( const char * const data, const size_t size );
+
+
+/*! @class
+	@brief The 'snapshot' class declaration. A read only view of a snapshot
+	in memory, which must stay mapped as long as the view is used. */
+template <class Key>
+class snapshot
+{
+	private:
+
+	typedef typename Key::type BIN; //!< The integer type of a key.
+
+
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function points the snapshot at a block of memory, such as a memory
+	mapped file, after checking that it holds a snapshot with keys of this
+	size, and that its keys, offsets, counts, and number of words agree
+	with each other, its words, and the header, so a damaged file is
+	rejected instead of read past its end or searched wrongly. This reads
+	the table and the words once. The memory must be aligned to at least 16
+	bytes.
+
+	@param[in] data - The start of the block.
+	@param[in] size - The size of the block.
+
+	@returns bool - True if the block holds a valid snapshot.
+	**************************************************************************/
+	bool open( const char * const data, const size_t size );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds a word in the snapshot.
+
+	@param[in] str - The word to find.
+
+	@returns size_t - The number of copies of the word.
+	**************************************************************************/
+	size_t find( const std::string_view str ) const;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds every word that starts with a prefix, in alphabetical
+	order, like dictionary::prefix().
+
+	@param[in] pre - The prefix.
+	@param[out] found - The words and their counts are added to the end of
+	                    this.
+
+	@returns size_t - The number of words found.
+	**************************************************************************/
+	size_t prefix( const std::string_view pre, std::vector<std::pair<std::string_view, size_t>> & found ) const;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds every word from one word to another, in alphabetical
+	order, like dictionary::range().
+
+	@param[in] low - The first word, or empty to start at the beginning.
+	@param[in] high - The last word, or empty to go to the end.
+	@param[out] found - The words and their counts are added to the end of
+	                    this.
+
+	@returns size_t - The number of words found.
+	**************************************************************************/
+	size_t range( const std::string_view low, const std::string_view high, std::vector<std::pair<std::string_view, size_t>> & found ) const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of different words in the snapshot.
+
+	@returns size_t - The number of words.
+	**************************************************************************/
+	size_t size() const { return head->words; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the total of every count, which is the number of
+	words that were read to make the dictionary.
+
+	@returns size_t - The total.
+	**************************************************************************/
+	size_t total() const { return head->total; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of spots in the table.
+
+	@returns size_t - The capacity of the dictionary that was saved.
+	**************************************************************************/
+	size_t capacity() const { return head->capacity; }
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the key in a spot of the table.
+
+	@param[in] i - The spot, up to and including capacity().
+
+	@returns BIN - The key, or all 1's if the spot is empty.
+	**************************************************************************/
+	BIN key( const size_t i ) const { return keys[i]; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the count of the word in a spot of the table.
+
+	@param[in] i - The spot.
+
+	@returns size_t - The count, or 0 if the spot is empty.
+	**************************************************************************/
+	size_t count( const size_t i ) const { return size_t( counts[i] ); }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the word in a spot of the table.
+
+	@param[in] i - The spot.
+
+	@returns std::string_view - The word, which points into the snapshot.
+	**************************************************************************/
+	std::string_view word( const size_t i ) const { return std::string_view( pool + offsets[i], size_t( offsets[i+1] - offsets[i] ) ); }
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints the words in the snapshot in the same format as
+	dictionary::print().
+
+	@param[in,out] txt - The stream to print the words to.
+	@param[in,out] csv - The stream to print the ranks and frequencies to.
+	**************************************************************************/
+	void print( std::ostream & txt, std::ostream & csv ) const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the header of a snapshot with keys of this size,
+	with every part placed right after the one before it.
+
+	@param[in] capacity - The number of spots in the table.
+	@param[in] words - The number of words in the table.
+	@param[in] total - The total of every count.
+	@param[in] chars - The number of characters in every word together.
+
+	@returns snapshotheader - The header.
+	**************************************************************************/
+	static snapshotheader layout( const uint64_t capacity, const uint64_t words, const uint64_t total, const uint64_t chars );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function merges snapshots with keys of this size into one, adding up
+	the counts of words that are in more than one. The snapshots are read in
+	alphabetical order all at once, and the merged table is laid out as it
+	goes, the same way dictionary::merge() lays out its list, so only a block
+	of each part of the new snapshot is held in memory at a time.
+
+	@param[in] parts - The snapshots to merge. There must be at least one.
+	@param[in,out] out - The binary stream to write the merged snapshot to.
+	                     It has to be seekable, since the parts of the
+	                     snapshot are written at the same time.
+
+	@returns bool - True if everything was written.
+	**************************************************************************/
+	static bool merge( const std::vector<snapshot> & parts, std::ostream & out );
+
+
+	private:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function finds the spot a word is in, or the spot it would be in.
+
+	@param[in] K - The key of the word.
+	@param[in] str - The word.
+
+	@returns size_t - The spot.
+	**************************************************************************/
+	size_t locate( const BIN K, const std::string_view str ) const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function reads the words of snapshots in alphabetical order, all at
+	once, and passes each different word to a function, along with its key
+	and the total of its counts.
+
+	@param[in] parts - The snapshots to read.
+	@param[in] visit - The function to pass each word to. It returns false to
+	                   stop.
+
+	@returns bool - False if 'visit' stopped early.
+	**************************************************************************/
+	template <class Visit>
+	static bool combine( const std::vector<snapshot> & parts, Visit visit );
+
+
+	const snapshotheader * head = nullptr; //!< The header.
+
+	const BIN * keys = nullptr; //!< The key in each spot.
+
+	const uint64_t * counts = nullptr; //!< The count in each spot.
+
+	const uint64_t * offsets = nullptr; //!< The start of each spot's word in 'pool'.
+
+	const char * pool = nullptr; //!< The characters of every word.
+};
+
+
+#endif /* SNAPSHOT_H */
@@ -0,0 +1,389 @@
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include "streamreader.h"
+#include "tokenizer.h"
+
+#ifdef _WIN32
+	#include <fcntl.h>
+	#include <io.h>
+#endif
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+	#include <sys/stat.h>
+	#define HAVE_STAT true
+#else
+	#define HAVE_STAT false
+#endif
+
+
+// The size of the members or frames to decompress together on one thread.
+// Big enough that starting a thread takes no time in comparison.
+#define DECODE_GROUP ( 4 << 20 )
+
+// The most compressed bytes to hold while looking for the end of a member or
+// frame. If it doesn't end by then, it's decompressed on this thread as it's
+// read instead.
+#define DECODE_FRAME_MAX ( 64 << 20 )
+
+
+streamreader::~streamreader()
+{
+	close();
+}
+
+
+bool streamreader::open( const std::string & path, const unsigned threads )
+{
+	close();
+
+	if ( path == "-" )
+	{
+		file = stdin;
+
+		// Windows would otherwise turn "\r\n" into "\n" and stop at a ^Z.
+		#ifdef _WIN32
+		_setmode( _fileno( stdin ), _O_BINARY );
+		#endif
+	}
+
+	else file = std::fopen( path.c_str(), "rb" );
+
+	if ( !file ) return false;
+
+	this->path = path;
+
+	// Everything is read straight into our own buffer, so the FILE's buffer
+	// would only add a copy.
+	std::setvbuf( file, nullptr, _IONBF, 0 );
+
+	// Read the start of the file to see if it's compressed. If it isn't,
+	// these bytes are the start of the text.
+	raw.resize( blockSize );
+	refill();
+
+	type = decompressor::detect( raw.data(), rawFilled );
+	if ( !decompressor::supported( type ) )
+	{
+		close();
+
+		return false;
+	}
+
+	if ( type != decompressor::plain )
+	{
+		this->threads = ( threads ? threads : 1 );
+		parallel = ( this->threads > 1 );
+	}
+
+	return true;
+}
+
+void streamreader::close()
+{
+	if ( file && file != stdin ) std::fclose( file );
+
+	file = nullptr;
+	path.clear();
+	offset = 0;
+	following = false;
+
+	carry.clear();
+	ended = false;
+	failed = false;
+
+	// Wait for any groups still being decompressed.
+	pending.clear();
+	current = group();
+	taken = 0;
+
+	raw.clear();
+	rawUsed = rawFilled = 0;
+	drained = false;
+
+	type = decompressor::plain;
+	serial.reset();
+	threads = 1;
+	parallel = false;
+}
+
+
+bool streamreader::read( const char * & first, const char * & last )
+{
+	size_t length = 0;
+	const bool more = read( buffer, length );
+
+	first = buffer.data();
+	last = buffer.data() + length;
+
+	return more;
+}
+
+bool streamreader::read( std::vector<char> & block, size_t & length )
+{
+	length = 0;
+
+	if ( !file ) return false;
+
+	// Reading stopped at the end of a followed file last time, and has to be
+	// told to try again.
+	if ( following )
+	{
+		std::clearerr( file );
+		drained = false;
+	}
+
+	if ( block.size() < blockSize ) block.resize( blockSize );
+	if ( block.size() < 2 * carry.size() ) block.resize( 2 * carry.size() );
+
+	// Start with the part of a word left over from the last block.
+	std::copy( carry.begin(), carry.end(), block.begin() );
+	size_t filled = carry.size(), cut = 0;
+	carry.clear();
+
+	while ( !ended )
+	{
+		// Fill the block. It only comes up short at the end of the text.
+		const size_t n = fill( block.data() + filled, block.size() - filled );
+		filled += n;
+
+		if ( filled < block.size() )
+		{
+			// The end of a followed file is only the end of what has been
+			// written so far, so the last word may not be finished yet.
+			// If it's been replaced, though, that was all of it.
+			if ( following )
+			{
+				cut = ( reopen() ? filled : tokenizer::boundaryBefore( block.data(), block.data() + filled ) - block.data() );
+
+				break;
+			}
+
+			ended = true;
+		}
+
+		// Cut the block off before any word that might continue in the next
+		// one.
+		else cut = tokenizer::boundaryBefore( block.data(), block.data() + filled ) - block.data();
+
+		// If the whole block is a single word, make it bigger and keep
+		// reading.
+		if ( !ended && !cut ) block.resize( block.size() * 2 );
+		else break;
+	}
+
+	if ( ended ) cut = filled;
+
+	carry.assign( block.data() + cut, block.data() + filled );
+	length = cut;
+
+	return cut != 0;
+}
+
+
+size_t streamreader::fill( char * dst, const size_t n )
+{
+	char * const end = dst + n;
+
+	// A file that isn't compressed is read straight into the block, after
+	// whatever was read to check if it was compressed.
+	if ( type == decompressor::plain )
+	{
+		const size_t first = std::min( n, rawFilled - rawUsed );
+		std::memcpy( dst, raw.data() + rawUsed, first );
+		rawUsed += first;
+
+		// fread() only comes up short at the end of the file, or on an
+		// error, which also ends the text, but is remembered.
+		const size_t more = ( first < n && !drained ? std::fread( dst + first, 1, n - first, file ) : 0 );
+		offset += more;
+
+		if ( std::ferror( file ) ) failed = true;
+
+		return first + more;
+	}
+
+	while ( dst != end )
+	{
+		// Read what's left of the group being read.
+		if ( taken < current.text.size() )
+		{
+			const size_t k = std::min( size_t( end - dst ), current.text.size() - taken );
+			std::memcpy( dst, current.text.data() + taken, k );
+
+			dst += k;
+			taken += k;
+
+			continue;
+		}
+
+		// The text ends wherever a group was corrupt.
+		if ( current.broken )
+		{
+			failed = true;
+
+			break;
+		}
+
+		// Then the next group, and start decompressing another one.
+		if ( parallel ) launch();
+
+		if ( pending.size() )
+		{
+			current = pending.front().get();
+			pending.pop_front();
+			taken = 0;
+
+			continue;
+		}
+
+		// If every member or frame was decompressed in a group, the text
+		// ended with the last one.
+		if ( !serial && rawUsed == rawFilled && drained ) break;
+
+		// The rest of the file is decompressed here.
+		if ( !serial ) serial.reset( new decompressor( type ) );
+
+		const char * in = raw.data() + rawUsed;
+		const decompressor::result r = serial->decode( in, raw.data() + rawFilled, dst, end, drained );
+		rawUsed = in - raw.data();
+
+		if ( r != decompressor::more )
+		{
+			failed = ( r == decompressor::error || std::ferror( file ) );
+
+			break;
+		}
+
+		// If it stopped short, it needs more input. Once there is none, the
+		// next decode() is told so, and ends or fails instead.
+		if ( dst != end ) refill();
+	}
+
+	return n - size_t( end - dst );
+}
+
+bool streamreader::refill()
+{
+	if ( drained ) return false;
+
+	// Keep the bytes that haven't been used, and read after them.
+	std::memmove( raw.data(), raw.data() + rawUsed, rawFilled - rawUsed );
+	rawFilled -= rawUsed;
+	rawUsed = 0;
+
+	if ( rawFilled == raw.size() ) raw.resize( raw.size() * 2 );
+
+	const size_t n = std::fread( raw.data() + rawFilled, 1, raw.size() - rawFilled, file );
+	rawFilled += n;
+	offset += n;
+
+	if ( !n ) drained = true;
+
+	return n != 0;
+}
+
+void streamreader::launch()
+{
+	while ( pending.size() < threads )
+	{
+		// Collect whole members or frames until the group is big enough.
+		size_t length = 0;
+		while ( length < DECODE_GROUP )
+		{
+			const size_t next = decompressor::frame( type, raw.data() + rawUsed + length, rawFilled - rawUsed - length );
+
+			if ( next ) length += next;
+
+			// The end of the file, or of the data.
+			else if ( rawUsed + length == rawFilled && drained ) break;
+
+			// The member or frame may just be cut off, so read more of it,
+			// unless it's too big to hold.
+			else if ( rawFilled - rawUsed - length < DECODE_FRAME_MAX && refill() ) continue;
+
+			else
+			{
+				// This member or frame has to be decompressed as it's read,
+				// along with everything after it.
+				if ( !length ) parallel = false;
+
+				break;
+			}
+		}
+
+		if ( !length ) return;
+
+		pending.push_back( std::async( std::launch::async, decompress, type, std::vector<char>( raw.data() + rawUsed, raw.data() + rawUsed + length ) ) );
+		rawUsed += length;
+	}
+}
+
+streamreader::group streamreader::decompress( const decompressor::format f, const std::vector<char> data )
+{
+	decompressor d( f );
+	group g;
+
+	// Text usually compresses to about a quarter of its size, and the buffer
+	// doubles whenever that's not enough.
+	g.text.resize( 4 * data.size() + 1 );
+
+	const char * in = data.data();
+	size_t written = 0;
+
+	while ( true )
+	{
+		char * out = g.text.data() + written;
+		const decompressor::result r = d.decode( in, data.data() + data.size(), out, g.text.data() + g.text.size(), true );
+		written = out - g.text.data();
+
+		// Anything but the end of the data, with room left over, means the
+		// data is corrupt or stops in the middle of a member or frame.
+		if ( r != decompressor::more || written < g.text.size() )
+		{
+			g.broken = ( r != decompressor::end );
+
+			break;
+		}
+
+		g.text.resize( g.text.size() * 2 );
+	}
+
+	g.text.resize( written );
+
+	return g;
+}
+
+bool streamreader::reopen()
+{
+	// A file that's shorter than what has been read of it isn't the text that
+	// was read anymore.
+	std::error_code error;
+	const std::uintmax_t size = std::filesystem::file_size( path, error );
+	if ( error ) return false;
+
+	bool replaced = ( size < offset );
+
+	// Where files have inode numbers, a file that was renamed, and replaced
+	// by a new one, can be told apart even if the new one is bigger.
+	#if HAVE_STAT
+	struct stat named, opened;
+	if ( stat( path.c_str(), &named ) == 0 && fstat( fileno( file ), &opened ) == 0 )
+		replaced = replaced || named.st_dev != opened.st_dev || named.st_ino != opened.st_ino;
+	#endif
+
+	if ( !replaced ) return false;
+
+	std::FILE * const again = std::fopen( path.c_str(), "rb" );
+	if ( !again ) return false;
+
+	std::fclose( file );
+	file = again;
+	std::setvbuf( file, nullptr, _IONBF, 0 );
+
+	offset = 0;
+	rawUsed = rawFilled = 0;
+
+	return true;
+}
@@ -0,0 +1,282 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the streamreader class.
+
+A streamreader reads text from standard input, a pipe, or any other file that
+can't be mapped into memory, one fixed-size block at a time. Each block ends at
+a word boundary; the start of a word that is cut off at the end of the buffer is
+carried over to the start of the next block. Only one buffer is ever held, so
+memory use doesn't depend on how much text is read, unless a single word is
+longer than the buffer.
+
+Blocks can also be read into buffers owned by the caller, so that a reader
+thread can fill one buffer while the text of another is still being used, as
+the pipeline does.
+
+Text compressed with gzip or zstd is decompressed as it's read, so it never
+has to be decompressed to disk first. If the compressed members or frames say
+where they end, as bgzip and pzstd files do, groups of them are decompressed
+on several threads at once, a few groups ahead of the text being read.
+Otherwise one thread decompresses everything, in order. Data that turns out
+to be corrupt, or is cut off, ends the text, like a read error does, and
+broken() tells either apart from the real end of the text.
+
+A file that is still being written to, like a log, can be followed: the end
+of what has been written so far isn't taken to be the end of the text, and
+each read() after it only returns what has been written since.
+******************************************************************************/
+
+#ifndef STREAMREADER_H
+#define STREAMREADER_H
+
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+#include "decompressor.h"
+
+
+/*! @class
+	@brief The 'streamreader' class declaration. */
+class streamreader
+{
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes a streamreader that isn't reading anything yet.
+	The buffer isn't allocated until the first read().
+
+	@param[in] size - The size of the buffer.
+	**************************************************************************/
+	streamreader( const size_t size = 1 << 20 ) : blockSize( size ) {}
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function closes the file, if one is open.
+	**************************************************************************/
+	~streamreader();
+
+	streamreader( const streamreader & ) = delete;
+	streamreader & operator = ( const streamreader & ) = delete;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function opens a file to read from. Any previously opened file is
+	closed first. The start of the file is read right away, to tell if it's
+	compressed.
+
+	@param[in] path - The name of the file to read, or "-" for standard
+	                  input.
+	@param[in] threads - The most threads to decompress with at once.
+
+	@returns bool - True if the file was opened, and isn't compressed in a
+	                format this program wasn't built to read.
+	**************************************************************************/
+	bool open( const std::string & path, const unsigned threads = 1 );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function closes the file. Standard input is left open.
+	**************************************************************************/
+	void close();
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function reads the next block of text. The block ends at a word
+	boundary, or at the end of the file. It is only valid until the next call
+	to read().
+
+	@param[out] first - The start of the block.
+	@param[out] last - The end of the block.
+
+	@returns bool - False if there is nothing left to read.
+	**************************************************************************/
+	bool read( const char * & first, const char * & last );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function reads the next block of text into a buffer owned by the
+	caller, which is made bigger if a single word doesn't fit in it. The
+	block ends at a word boundary, or at the end of the file, and stays
+	valid until the buffer is changed, no matter what else is read.
+
+	@param[in,out] block - The buffer to read into. If it's empty, it gets
+	                       the size this streamreader was made with.
+	@param[out] length - The number of bytes of the block.
+
+	@returns bool - False if there is nothing left to read.
+	**************************************************************************/
+	bool read( std::vector<char> & block, size_t & length );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the format the file is compressed in.
+
+	@returns decompressor::format - The format, or 'plain' if it isn't
+	                                compressed.
+	**************************************************************************/
+	decompressor::format format() const { return type; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns whether the text ended early, because the file
+	couldn't be read, or its compressed data was corrupt or cut off. The
+	text before that was still returned by read().
+
+	@returns bool - True if the text ended early.
+	**************************************************************************/
+	bool broken() const { return failed; }
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function turns following on or off. While a file is followed,
+	read() returns false at the end of what has been written to it so far,
+	and leaves a word that may not be finished yet for later. It can be
+	called again at any time to get the whole words written since. If the
+	name of the file is given to a new file, as logs are when they're
+	rotated, or the file gets shorter than what has been read of it, the
+	new file is read from the start once everything in the old one has
+	been. Once following is turned off, read() ends at the end of the file
+	again, and returns the last word too.
+
+	Only files that aren't compressed can be followed.
+
+	@param[in] on - Whether to follow the file.
+	**************************************************************************/
+	void follow( const bool on ) { following = on; }
+
+
+	private:
+
+	/*! @struct
+		@brief The 'group' struct definition. Members or frames decompressed
+		together on another thread. */
+	struct group
+	{
+		std::vector<char> text; //!< The text.
+
+		bool broken = false; //!< True if the data was corrupt or cut off after 'text'.
+	};
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function gets the next bytes of text, decompressing them if the file
+	is compressed.
+
+	@param[out] dst - Where to put the text.
+	@param[in] n - The most bytes to get.
+
+	@returns size_t - The number of bytes put in 'dst'. Less than 'n' only
+	                  at the end of the text.
+	**************************************************************************/
+	size_t fill( char * dst, const size_t n );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function reads more of the file into 'raw', after the bytes of it
+	that haven't been used, which are moved to the front first.
+
+	@returns bool - False if nothing more could be read.
+	**************************************************************************/
+	bool refill();
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function starts decompressing groups of members or frames on other
+	threads, until 'threads' groups are being decompressed or are waiting to
+	be read. If the end of the next member or frame can't be found, every
+	group after this is decompressed on this thread instead.
+	**************************************************************************/
+	void launch();
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function decompresses a group of members or frames. It runs on its
+	own thread.
+
+	@param[in] f - The format of the data.
+	@param[in] data - The members or frames.
+
+	@returns group - The text.
+	**************************************************************************/
+	static group decompress( const decompressor::format f, const std::vector<char> data );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function opens a followed file again, once the end of it has been
+	read, if its name now belongs to another file, or if it has gotten
+	shorter than what has been read of it.
+
+	@returns bool - True if the file was opened again.
+	**************************************************************************/
+	bool reopen();
+
+
+	std::FILE * file = nullptr; //!< The file being read.
+
+	std::string path; //!< The name of the file, to open it again if it's replaced.
+
+	size_t offset = 0; //!< The number of bytes read from the file.
+
+	bool following = false; //!< True if the file is being followed.
+
+	std::vector<char> buffer; //!< The block read by the first read().
+
+	std::vector<char> carry; //!< The start of a word cut off at the end of the last block.
+
+	size_t blockSize; //!< The starting size of a block.
+
+	std::vector<char> raw; //!< Bytes read from the file that may not have been used yet.
+
+	size_t rawUsed = 0; //!< The number of bytes of 'raw' that have been used.
+
+	size_t rawFilled = 0; //!< The number of bytes in 'raw'.
+
+	bool drained = false; //!< True once there is nothing more to read from the file.
+
+	decompressor::format type = decompressor::plain; //!< The format of the file.
+
+	std::unique_ptr<decompressor> serial; //!< The decompressor for the groups decompressed on this thread.
+
+	unsigned threads = 1; //!< The most groups decompressed at once.
+
+	bool parallel = false; //!< True while groups are being decompressed on other threads.
+
+	std::deque<std::future<group>> pending; //!< The groups being decompressed, in order.
+
+	group current; //!< The group being read from.
+
+	size_t taken = 0; //!< The number of bytes of 'current' that have been read.
+
+	bool ended = false; //!< True once the end of the text is reached.
+
+	bool failed = false; //!< True if the text ended because of a read error, or corrupt or cut off data.
+};
+
+
+#endif /* STREAMREADER_H */
@@ -0,0 +1,510 @@
+#include <cstdint>
+#include <cstring>
+#include "alphabets.h"
+#include "tokenizer.h"
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+	#include <immintrin.h>
+	#define TOKENIZER_X86 true
+#else
+	#define TOKENIZER_X86 false
+#endif
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+	inline unsigned CTZ( const uint64_t m ) { unsigned long i; _BitScanForward64( &i, m ); return i; }
+#else
+	#define CTZ __builtin_ctzll
+#endif
+
+
+// What the byte 'c' can be in a word, from the alphabet's table. Unlike
+// isalpha(), this never looks at the current locale, and it is safe to use with
+// negative chars.
+#define KIND( c ) ( alphabet::table.kind[static_cast<unsigned char>( c )] )
+
+
+namespace
+{
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function checks if a character can be part of a word.
+
+	@param[in] cp - The character, or UTF8_INVALID.
+
+	@returns bool - True if it's a letter, or a character that can be inside
+	                a word.
+	**************************************************************************/
+	inline bool isWord( const uint32_t cp )
+	{
+		if ( cp < 0x80 ) return KIND( cp ) != bytetable::other;
+
+		return ( alphabet::unicode && unicodeLetter( cp ) );
+	}
+
+
+	/*! @struct
+		@brief A character that started at the end of one 64 byte chunk and
+		goes on into the next one. */
+	struct spill
+	{
+		unsigned bytes = 0; //!< The number of its bytes in the next chunk.
+
+		bool word = false; //!< True if it's a letter.
+
+		char tail[3]; //!< Its bytes in the next chunk, lowercased.
+	};
+
+
+	/*! @struct
+		@brief Turns bitmasks of word characters into words. */
+	struct scanner
+	{
+		const char * text; //!< The lowercased text.
+
+		std::vector<std::string_view> & words; //!< Where to put the words.
+
+		size_t start = 0; //!< The start of the current run of word characters.
+
+		bool inRun = false; //!< Whether we are in a run of word characters.
+
+
+		/******************************************************************//**
+		@author John Colton
+
+		@par Description:
+		This function adds the words in a run of word characters. Characters
+		that can only be inside a word, like apostrophes, are trimmed from both
+		ends, and a run of only those is ignored.
+
+		@param[in] first - The start of the run.
+		@param[in] last - The end of the run.
+		**********************************************************************/
+		void emit( size_t first, size_t last )
+		{
+			while ( first < last && KIND( text[first] ) == bytetable::inner ) ++first;
+			while ( last > first && KIND( text[last-1] ) == bytetable::inner ) --last;
+
+			if ( first < last ) words.emplace_back( text + first, last - first );
+		}
+
+		/******************************************************************//**
+		@author John Colton
+
+		@par Description:
+		This function adds the words found in a bitmask of up to 64 bytes,
+		where a set bit means that byte is part of a word character. A run of
+		set bits may continue from the previous mask and into the next one.
+
+		@param[in] mask - The bitmask. Bits past 'n' must be 0.
+		@param[in] base - The offset of the first byte in the mask.
+		@param[in] n - The number of bytes in the mask.
+		**********************************************************************/
+		void scan( const uint64_t mask, const size_t base, const unsigned n )
+		{
+			const uint64_t other = ~mask & ( n == 64 ? ~uint64_t( 0 ) : ( uint64_t( 1 ) << n ) - 1 );
+
+			unsigned i = 0;
+
+			while ( i < n )
+			{
+				// Find the start of the next run.
+				if ( !inRun )
+				{
+					const uint64_t m = mask >> i;
+					if ( !m ) return;
+
+					i += CTZ( m ); start = base + i; inRun = true;
+				}
+
+				// Find the end of the run. If it's not in this mask, it
+				// continues into the next one.
+				const uint64_t m = other >> i;
+				if ( !m ) return;
+
+				i += CTZ( m ); emit( start, base + i ); inRun = false;
+			}
+		}
+	};
+
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function lowercases up to 64 bytes, one at a time, and returns a
+	bitmask of which bytes can be part of a word. Bytes over 127 never are.
+
+	@param[in] in - The bytes to classify.
+	@param[out] out - Where to write the lowercased bytes.
+	@param[in] n - The number of bytes. Must be <= 64.
+
+	@returns uint64_t - The bitmask.
+	**************************************************************************/
+	inline uint64_t classifyScalar( const char * in, char * out, const size_t n )
+	{
+		uint64_t mask = 0;
+
+		for ( size_t i = 0; i < n; ++i )
+		{
+			const unsigned char c = in[i];
+
+			out[i] = alphabet::table.lower[c];
+			mask |= uint64_t( alphabet::table.kind[c] != bytetable::other ) << i;
+		}
+
+		return mask;
+	}
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function case folds up to 64 bytes of UTF-8, a character at a time,
+	and returns a bitmask of which bytes are part of a word character. Every
+	byte of a letter's character is set, so a word is a run of set bits, just
+	as it is in ASCII.
+
+	A character that goes past the end of the chunk is folded whole, and
+	the bytes that belong to the next chunk are kept in 'carry', since the
+	next chunk's output may be written over before it is classified.
+
+	@param[in] in - The bytes to classify.
+	@param[out] out - Where to write the lowercased bytes.
+	@param[in] n - The number of bytes. Must be <= 64.
+	@param[in] avail - The number of bytes from 'in' to the end of the text.
+	@param[in,out] carry - The end of the character that went past the last
+	                       chunk, replaced by the one that goes past this one.
+
+	@returns uint64_t - The bitmask.
+	**************************************************************************/
+	inline uint64_t classifyUTF8( const char * in, char * out, const size_t n, const size_t avail, spill & carry )
+	{
+		// Finish the character the last chunk started.
+		size_t i = carry.bytes;
+		std::memcpy( out, carry.tail, i );
+
+		uint64_t mask = ( carry.word ? ( uint64_t( 1 ) << i ) - 1 : 0 );
+		bool word = false;
+
+		while ( i < n )
+		{
+			const unsigned char c = in[i];
+
+			if ( c < 0x80 )
+			{
+				out[i] = alphabet::table.lower[c];
+				word = ( alphabet::table.kind[c] != bytetable::other );
+				mask |= uint64_t( word ) << i++;
+
+				continue;
+			}
+
+			// An invalid byte is one character by itself, and is left alone.
+			const char * pos = in + i;
+			const uint32_t cp = utf8Decode( pos, in + avail );
+			const size_t length = pos - ( in + i );
+
+			word = isWord( cp );
+
+			char lower[4];
+			if ( word ) utf8Encode( unicodeFold( cp ), lower );
+			else std::memcpy( lower, in + i, length );
+
+			const size_t here = ( i + length < n ? length : n - i );
+			std::memcpy( out + i, lower, here );
+
+			if ( word ) mask |= ( ( uint64_t( 1 ) << here ) - 1 ) << i;
+
+			if ( here < length ) std::memcpy( carry.tail, lower + here, length - here );
+
+			i += length;
+		}
+
+		carry.bytes = unsigned( i - n );
+		carry.word = ( carry.bytes && word );
+
+		return mask;
+	}
+
+	#if TOKENIZER_X86
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function lowercases 64 bytes, 16 at a time, and returns a bitmask of
+	which bytes can be part of a word.
+
+	A byte is a letter if ( byte | 0x20 ) is from 'a' to 'z'. SSE2 only has a
+	signed compare, so the range is shifted to start at -128, which means one
+	compare tells us if it's in the range. Digits are found the same way, if
+	the alphabet has them. The checks for characters the alphabet doesn't
+	have are compiled out.
+
+	@param[in] in - The bytes to classify.
+	@param[out] out - Where to write the lowercased bytes.
+	@param[out] ascii - Set to false if any of the bytes are over 127, which
+	                    only UTF-8 alphabets look for. The bitmask is then
+	                    wrong, and classifyUTF8() must be used instead.
+
+	@returns uint64_t - The bitmask.
+	**************************************************************************/
+	__attribute__(( target( "sse2" ) ))
+	inline uint64_t classifySSE2( const char * in, char * out, bool & ascii )
+	{
+		const __m128i bit = _mm_set1_epi8( 0x20 );
+		const __m128i shift = _mm_set1_epi8( char( 128 - 'a' ) );
+		const __m128i limit = _mm_set1_epi8( char( -128 + 26 ) );
+		const __m128i apos = _mm_set1_epi8( '\'' );
+		const __m128i hyphen = _mm_set1_epi8( '-' );
+		const __m128i digitShift = _mm_set1_epi8( char( 128 - '0' ) );
+		const __m128i digitLimit = _mm_set1_epi8( char( -128 + 10 ) );
+
+		uint64_t mask = 0;
+		int high = 0;
+
+		for ( int i = 0; i < 64; i += 16 )
+		{
+			const __m128i v = _mm_loadu_si128( reinterpret_cast<const __m128i *>( in + i ) );
+
+			const __m128i letter = _mm_cmpgt_epi8( limit, _mm_add_epi8( _mm_or_si128( v, bit ), shift ) );
+
+			_mm_storeu_si128( reinterpret_cast<__m128i *>( out + i ), _mm_or_si128( v, _mm_and_si128( letter, bit ) ) );
+
+			__m128i word = _mm_or_si128( letter, _mm_cmpeq_epi8( v, apos ) );
+			if ( alphabet::digits ) word = _mm_or_si128( word, _mm_cmpgt_epi8( digitLimit, _mm_add_epi8( v, digitShift ) ) );
+			if ( alphabet::hyphens ) word = _mm_or_si128( word, _mm_cmpeq_epi8( v, hyphen ) );
+			if ( alphabet::unicode ) high |= _mm_movemask_epi8( v );
+
+			mask |= uint64_t( uint16_t( _mm_movemask_epi8( word ) ) ) << i;
+		}
+
+		if ( high ) ascii = false;
+
+		return mask;
+	}
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function lowercases 64 bytes, 32 at a time, and returns a bitmask of
+	which bytes can be part of a word. See classifySSE2().
+
+	@param[in] in - The bytes to classify.
+	@param[out] out - Where to write the lowercased bytes.
+	@param[out] ascii - Set to false if any of the bytes are over 127.
+
+	@returns uint64_t - The bitmask.
+	**************************************************************************/
+	__attribute__(( target( "avx2" ) ))
+	inline uint64_t classifyAVX2( const char * in, char * out, bool & ascii )
+	{
+		const __m256i bit = _mm256_set1_epi8( 0x20 );
+		const __m256i shift = _mm256_set1_epi8( char( 128 - 'a' ) );
+		const __m256i limit = _mm256_set1_epi8( char( -128 + 26 ) );
+		const __m256i apos = _mm256_set1_epi8( '\'' );
+		const __m256i hyphen = _mm256_set1_epi8( '-' );
+		const __m256i digitShift = _mm256_set1_epi8( char( 128 - '0' ) );
+		const __m256i digitLimit = _mm256_set1_epi8( char( -128 + 10 ) );
+
+		uint64_t mask = 0;
+		int high = 0;
+
+		for ( int i = 0; i < 64; i += 32 )
+		{
+			const __m256i v = _mm256_loadu_si256( reinterpret_cast<const __m256i *>( in + i ) );
+
+			const __m256i letter = _mm256_cmpgt_epi8( limit, _mm256_add_epi8( _mm256_or_si256( v, bit ), shift ) );
+
+			_mm256_storeu_si256( reinterpret_cast<__m256i *>( out + i ), _mm256_or_si256( v, _mm256_and_si256( letter, bit ) ) );
+
+			__m256i word = _mm256_or_si256( letter, _mm256_cmpeq_epi8( v, apos ) );
+			if ( alphabet::digits ) word = _mm256_or_si256( word, _mm256_cmpgt_epi8( digitLimit, _mm256_add_epi8( v, digitShift ) ) );
+			if ( alphabet::hyphens ) word = _mm256_or_si256( word, _mm256_cmpeq_epi8( v, hyphen ) );
+			if ( alphabet::unicode ) high |= _mm256_movemask_epi8( v );
+
+			mask |= uint64_t( uint32_t( _mm256_movemask_epi8( word ) ) ) << i;
+		}
+
+		if ( high ) ascii = false;
+
+		return mask;
+	}
+	#endif
+
+
+	// Classify 64 bytes at a time with CLASSIFY, then finish the last few
+	// bytes with classifyScalar(). In a UTF-8 alphabet, chunks that aren't
+	// all ASCII, and the last few bytes, are classified by classifyUTF8().
+	#define TOKENIZE_WITH( CLASSIFY ) \
+		size_t off = 0; \
+		spill carry; \
+		for ( ; off + 64 <= n; off += 64 ) \
+		{ \
+			bool ascii = true; \
+			uint64_t mask = CLASSIFY( in + off, out + off, ascii ); \
+			if ( !ascii ) mask = classifyUTF8( in + off, out + off, 64, n - off, carry ); \
+			s.scan( mask, off, 64 ); \
+		} \
+		s.scan( alphabet::unicode ? classifyUTF8( in + off, out + off, n - off, n - off, carry ) : classifyScalar( in + off, out + off, n - off ), off, unsigned( n - off ) );
+
+	// The signature of the tokenize functions below.
+	typedef void ( * kernel )( const char * in, char * out, const size_t n, scanner & s );
+
+	inline uint64_t classifyScalar64( const char * in, char * out, bool & ascii )
+	{
+		// Without SIMD, checking for bytes over 127 first would cost as much
+		// as classifying the chunk as UTF-8.
+		if ( alphabet::unicode )
+		{
+			ascii = false;
+
+			return 0;
+		}
+
+		return classifyScalar( in, out, 64 );
+	}
+
+	void tokenizeScalar( const char * in, char * out, const size_t n, scanner & s ) { TOKENIZE_WITH( classifyScalar64 ) }
+
+	#if TOKENIZER_X86
+	__attribute__(( target( "sse2" ) ))
+	void tokenizeSSE2( const char * in, char * out, const size_t n, scanner & s ) { TOKENIZE_WITH( classifySSE2 ) }
+
+	__attribute__(( target( "avx2" ) ))
+	void tokenizeAVX2( const char * in, char * out, const size_t n, scanner & s ) { TOKENIZE_WITH( classifyAVX2 ) }
+	#endif
+
+	#undef TOKENIZE_WITH
+
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function picks the fastest tokenize function this CPU supports.
+
+	@returns kernel - The tokenize function to use.
+	**************************************************************************/
+	kernel pickKernel()
+	{
+		#if TOKENIZER_X86
+		__builtin_cpu_init();
+
+		if ( __builtin_cpu_supports( "avx2" ) ) return tokenizeAVX2;
+
+		if ( __builtin_cpu_supports( "sse2" ) ) return tokenizeSSE2;
+		#endif
+
+		return tokenizeScalar;
+	}
+}
+
+
+const std::vector<std::string_view> & tokenizer::tokenize( const char * first, const char * last )
+{
+	static const kernel best = pickKernel();
+
+	const size_t n = last - first;
+
+	words.clear();
+	if ( buffer.size() < n ) buffer.resize( n );
+
+	scanner s = { buffer.data(), words };
+
+	best( first, buffer.data(), n, s );
+
+	// If the block ended in the middle of a run, that's the end of the word.
+	if ( s.inRun ) s.emit( s.start, n );
+
+	return words;
+}
+
+const char * tokenizer::boundary( const char * pos, const char * const end )
+{
+	if ( !alphabet::unicode )
+	{
+		while ( pos != end && KIND( *pos ) != bytetable::other ) ++pos;
+
+		return pos;
+	}
+
+	// Get out of the middle of a character, then past any word characters.
+	while ( pos != end && ( *pos & 0xC0 ) == 0x80 ) ++pos;
+
+	while ( pos != end )
+	{
+		const char * next = pos;
+		if ( !isWord( utf8Decode( next, end ) ) ) break;
+
+		pos = next;
+	}
+
+	return pos;
+}
+
+const char * tokenizer::boundaryBefore( const char * const begin, const char * pos )
+{
+	if ( !alphabet::unicode )
+	{
+		while ( pos != begin && KIND( pos[-1] ) != bytetable::other ) --pos;
+
+		return pos;
+	}
+
+	while ( pos != begin )
+	{
+		// Find the start of the character before 'pos'. A character has at
+		// most 3 bytes after its first.
+		const char * lead = pos - 1;
+		while ( lead != begin && pos - lead < 4 && ( *lead & 0xC0 ) == 0x80 ) --lead;
+
+		// If 'pos' cuts a character off, the rest of it is still to come, so
+		// the cut has to go before it.
+		const unsigned length = utf8Length( *lead );
+		if ( length > unsigned( pos - lead ) )
+		{
+			pos = lead;
+
+			continue;
+		}
+
+		const char * next = lead;
+		if ( !isWord( utf8Decode( next, pos ) ) || next != pos ) return pos;
+
+		pos = lead;
+	}
+
+	return pos;
+}
+
+bool tokenizer::lowercase( std::string & str )
+{
+	size_t i = 0;
+
+	while ( i < str.size() )
+	{
+		const unsigned char c = str[i];
+
+		// A word can't start with a character that can only be inside one.
+		if ( c < 0x80 || !alphabet::unicode )
+		{
+			if ( alphabet::table.kind[c] == bytetable::other || ( !i && alphabet::table.kind[c] == bytetable::inner ) ) return false;
+
+			str[i++] = alphabet::table.lower[c];
+
+			continue;
+		}
+
+		const char * pos = str.data() + i;
+		const uint32_t cp = utf8Decode( pos, str.data() + str.size() );
+		if ( !isWord( cp ) ) return false;
+
+		i += utf8Encode( unicodeFold( cp ), str.data() + i );
+	}
+
+	return true;
+}
@@ -0,0 +1,107 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the tokenizer class.
+
+The tokenizer splits a block of text into words. What a word consists of
+depends on the alphabet the program is compiled with (see alphabets.h). By
+default it's the letters A-z and possibly an apostrophe. Words are returned in
+lowercase and will not have an apostrophe, or any other character that can only
+be inside a word, at the start or end.
+
+The text is classified 32 bytes at a time with AVX2, or 16 bytes at a time
+with SSE2, depending on what the CPU supports. Letters are lowercased in the
+same pass, and word boundaries are then found by scanning the resulting
+bitmasks rather than the text itself. A scalar version is used on CPUs without
+either instruction set. In the utf8 alphabet, a chunk of 64 bytes that isn't
+all ASCII is classified a character at a time instead, looking up which
+characters are letters and their case folded forms (see unicode.h).
+******************************************************************************/
+
+#ifndef TOKENIZER_H
+#define TOKENIZER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+/*! @class
+	@brief The 'tokenizer' class declaration. */
+class tokenizer
+{
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function splits a block of text into words. The block should end at
+	a word boundary (see boundary()), or at the end of the text, so that no
+	word is split in two.
+
+	The returned words point into a buffer owned by this tokenizer, and are
+	only valid until the next call to tokenize().
+
+	@param[in] first - The start of the block.
+	@param[in] last - The end of the block.
+
+	@returns const std::vector<std::string_view> & - The words in the block.
+	**************************************************************************/
+	const std::vector<std::string_view> & tokenize( const char * first, const char * last );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function moves a position forward until it is not in the middle of
+	a word, so that a block of text can be split there.
+
+	@param[in] pos - The position to start at.
+	@param[in] end - The end of the text.
+
+	@returns const char * - The first position at or after 'pos' that starts
+	                        a character that can't be part of a word, or
+	                        'end'.
+	**************************************************************************/
+	static const char * boundary( const char * pos, const char * const end );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function moves a position backward until it is not in the middle of
+	a word, so that a block of text can be cut off there without knowing
+	what comes after it.
+
+	@param[in] begin - The start of the text.
+	@param[in] pos - The position to start at.
+
+	@returns const char * - The last position at or before 'pos' that comes
+	                        right after a whole character that can't be part
+	                        of a word, or 'begin'.
+	**************************************************************************/
+	static const char * boundaryBefore( const char * const begin, const char * pos );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function lowercases a word given by the user, and checks that it
+	could be the start of a word found by tokenize(), so it can be looked up
+	in a dictionary. An empty word is allowed.
+
+	@param[in,out] str - The word.
+
+	@returns bool - True if the word is valid.
+	**************************************************************************/
+	static bool lowercase( std::string & str );
+
+
+	private:
+
+	std::vector<char> buffer; //!< The lowercased text.
+
+	std::vector<std::string_view> words; //!< The words found.
+};
+
+
+#endif /* TOKENIZER_H */
@@ -0,0 +1,268 @@
+#include <algorithm>
+#include <iostream>
+#include "report.h"
+#include "topk.h"
+
+
+// True if counter A should be printed before counter B: higher counts first,
+// then in alphabetical order, like dictionary::print().
+#define COUNTER_BEFORE( A, B ) ( (A).num != (B).num ? (A).num > (B).num : (A).str < (B).str )
+
+
+topk::topk( const size_t k ) : k( k ? k : 1 )
+{
+	// Reserving every counter up front means they never move, so 'index'
+	// can point at their strings.
+	counters.reserve( this->k );
+	heap.reserve( this->k );
+	where.reserve( this->k );
+	index.reserve( this->k );
+}
+
+
+void topk::insert( const std::string_view str, const size_t num )
+{
+	if ( str.empty() ) return;
+
+	// If the word has a counter, add to it.
+	if ( add( str, num ) ) return;
+
+	// Otherwise it gets a free counter, or takes over the counter with the
+	// lowest count. It could have occured that many times already without
+	// being counted.
+	const bool free = ( counters.size() < k );
+	const uint32_t c = claim( str );
+	counter & low = counters[c];
+
+	low.error = low.num;
+	low.num += num;
+
+	if ( free ) siftUp( where[c] );
+	else siftDown( 0 );
+}
+
+bool topk::add( const std::string_view str, const size_t num )
+{
+	const std::unordered_map<std::string_view, uint32_t>::const_iterator it = index.find( str );
+	if ( it == index.end() ) return false;
+
+	counters[it->second].num += num;
+	siftDown( where[it->second] );
+
+	return true;
+}
+
+size_t topk::offer( const std::string_view str, const size_t num, std::string & evicted )
+{
+	const bool free = ( counters.size() < k );
+	if ( str.empty() || ( !free && num <= counters[heap[0]].num ) ) return 0;
+
+	// The word that loses its counter, if there is one.
+	size_t low = 0;
+	if ( !free )
+	{
+		low = counters[heap[0]].num;
+		evicted = counters[heap[0]].str;
+	}
+
+	const uint32_t c = claim( str );
+
+	counters[c].num = num;
+	counters[c].error = 0;
+
+	if ( free ) siftUp( where[c] );
+	else siftDown( 0 );
+
+	return low;
+}
+
+size_t topk::find( const std::string_view str ) const
+{
+	const std::unordered_map<std::string_view, uint32_t>::const_iterator it = index.find( str );
+
+	return ( it != index.end() ? counters[it->second].num : 0 );
+}
+
+size_t topk::error( const std::string_view str ) const
+{
+	const std::unordered_map<std::string_view, uint32_t>::const_iterator it = index.find( str );
+
+	return ( it != index.end() ? counters[it->second].error : 0 );
+}
+
+
+void topk::merge( topk & other )
+{
+	// A word without a counter could have occured up to this many times.
+	const size_t lowA = bound(), lowB = other.bound();
+
+	std::vector<counter> merged;
+	merged.reserve( counters.size() + other.counters.size() );
+
+	// Every word in this one, plus its count in the other. The strings are
+	// copied, since both indexes point into them.
+	for ( const counter & c : counters )
+	{
+		const std::unordered_map<std::string_view, uint32_t>::const_iterator it = other.index.find( c.str );
+
+		const size_t num = ( it != other.index.end() ? other.counters[it->second].num : lowB );
+		const size_t error = ( it != other.index.end() ? other.counters[it->second].error : lowB );
+
+		merged.push_back( counter{ c.str, c.num + num, c.error + error } );
+	}
+
+	// Every word that is only in the other one.
+	for ( const counter & c : other.counters )
+	{
+		if ( index.count( c.str ) ) continue;
+
+		merged.push_back( counter{ c.str, c.num + lowA, c.error + lowA } );
+	}
+
+	// Keep the K highest counts.
+	if ( merged.size() > k )
+	{
+		std::nth_element( merged.begin(), merged.begin() + k, merged.end(),
+						  []( const counter & a, const counter & b ) { return a.num > b.num; } );
+
+		merged.resize( k );
+	}
+
+	clear();
+	other.clear();
+
+	for ( counter & c : merged )
+	{
+		const uint32_t i = uint32_t( counters.size() );
+
+		counters.push_back( std::move( c ) );
+		heap.push_back( i );
+		where.push_back( i );
+		index.emplace( counters[i].str, i );
+
+		siftUp( i );
+	}
+}
+
+
+size_t topk::bound() const
+{
+	return ( counters.size() < k ? 0 : counters[heap[0]].num );
+}
+
+void topk::print( std::ostream & txt, std::ostream & csv ) const
+{
+	// Put the counters in the order they're printed.
+	std::vector<const counter *> order;
+	order.reserve( counters.size() );
+	for ( const counter & c : counters ) order.push_back( &c );
+
+	std::sort( order.begin(), order.end(), []( const counter * a, const counter * b ) { return COUNTER_BEFORE( *a, *b ); } );
+
+
+	std::vector<std::string_view> words( order.size() );
+	for ( size_t i = 0; i < order.size(); ++i ) words[i] = order[i]->str;
+
+
+	report out( txt, &csv );
+
+	// Print each run of counters with the same count together.
+	for ( size_t i = 0, j = 0; i < order.size(); ++i )
+	{
+		if ( i + 1 == order.size() || order[i+1]->num != order[i]->num )
+		{
+			out.add( order[i]->num, &words[j], i + 1 - j );
+
+			j = i + 1;
+		}
+	}
+
+	out.write();
+}
+
+
+void topk::siftDown( size_t pos )
+{
+	const uint32_t c = heap[pos];
+	const size_t num = counters[c].num;
+
+	// While a child has a lower count, move the lower child up.
+	while ( true )
+	{
+		size_t child = 2 * pos + 1;
+		if ( child >= heap.size() ) break;
+
+		if ( child + 1 < heap.size() && counters[heap[child+1]].num < counters[heap[child]].num ) ++child;
+
+		if ( counters[heap[child]].num >= num ) break;
+
+		heap[pos] = heap[child];
+		where[heap[pos]] = uint32_t( pos );
+
+		pos = child;
+	}
+
+	heap[pos] = c;
+	where[c] = uint32_t( pos );
+}
+
+void topk::siftUp( size_t pos )
+{
+	const uint32_t c = heap[pos];
+	const size_t num = counters[c].num;
+
+	// While the parent has a higher count, move the parent down.
+	while ( pos )
+	{
+		const size_t parent = ( pos - 1 ) / 2;
+
+		if ( counters[heap[parent]].num <= num ) break;
+
+		heap[pos] = heap[parent];
+		where[heap[pos]] = uint32_t( pos );
+
+		pos = parent;
+	}
+
+	heap[pos] = c;
+	where[c] = uint32_t( pos );
+}
+
+uint32_t topk::claim( const std::string_view str )
+{
+	// A free counter starts at 0, at the bottom of the heap.
+	if ( counters.size() < k )
+	{
+		const uint32_t c = uint32_t( counters.size() );
+
+		counters.push_back( counter{ std::string( str ), 0, 0 } );
+		heap.push_back( c );
+		where.push_back( c );
+		index.emplace( counters[c].str, c );
+
+		return c;
+	}
+
+	// Otherwise take the counter with the lowest count, at the top of the
+	// heap. Reuse the old word's node in the index, rather than freeing it and
+	// allocating a new one.
+	const uint32_t c = heap[0];
+	counter & low = counters[c];
+
+	std::unordered_map<std::string_view, uint32_t>::node_type node = index.extract( low.str );
+
+	low.str.assign( str.data(), str.size() );
+
+	node.key() = low.str;
+	index.insert( std::move( node ) );
+
+	return c;
+}
+
+void topk::clear()
+{
+	index.clear();
+	counters.clear();
+	heap.clear();
+	where.clear();
+}
@@ -0,0 +1,250 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the topk class.
+
+A topk counts only the most frequent words, using at most K counters, with the
+Space-Saving algorithm. A word that already has a counter just adds to it. A
+new word gets a free counter if there is one; otherwise it takes over the
+counter with the lowest count, and starts from that count rather than 0.
+
+Counts can only be too high, never too low, and each counter remembers how
+much it could be too high by: the count it took over. No count is ever more
+than N / K too high, where N is the total number of words, and any word that
+occurs more than N / K times is guaranteed to have a counter. Memory use only
+depends on K, no matter how many different words there are.
+******************************************************************************/
+
+#ifndef TOPK_H
+#define TOPK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+/*! @class
+	@brief The 'topk' class declaration. */
+class topk
+{
+	public:
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function initializes an empty topk.
+
+	@param[in] k - The number of counters. Must be at least 1.
+	**************************************************************************/
+	topk( const size_t k );
+
+	topk( const topk & ) = delete;
+	topk & operator = ( const topk & ) = delete;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function counts copies of a word.
+
+	@param[in] str - The word to count.
+	@param[in] num - The number of copies of the word.
+	**************************************************************************/
+	void insert( const std::string_view str, const size_t num = 1 );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds to the count of a word, only if it has a counter.
+
+	@param[in] str - The word to count.
+	@param[in] num - The number of copies of the word.
+
+	@returns bool - True if the word has a counter.
+	**************************************************************************/
+	bool add( const std::string_view str, const size_t num );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function gives a word without a counter a counter with a known
+	count, if there is a free counter or the count is higher than the lowest
+	count. This lets the counts come from somewhere else, such as a sketch,
+	instead of from the Space-Saving algorithm.
+
+	@param[in] str - The word. Must not have a counter.
+	@param[in] num - The count of the word.
+	@param[out] evicted - The word that lost its counter, if any.
+
+	@returns size_t - The count of the word that lost its counter, or 0 if
+	                  no word did.
+	**************************************************************************/
+	size_t offer( const std::string_view str, const size_t num, std::string & evicted );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the count of a word.
+
+	@param[in] str - The word to find.
+
+	@returns size_t - The count of the word, which may be too high by up to
+	                  error( str ), or 0 if the word has no counter.
+	**************************************************************************/
+	size_t find( const std::string_view str ) const;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns how much the count of a word could be too high by.
+
+	@param[in] str - The word to find.
+
+	@returns size_t - The most the count could be too high by, or 0 if the
+	                  word has no counter.
+	**************************************************************************/
+	size_t error( const std::string_view str ) const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function adds the counts of another topk to this one. A word that
+	only has a counter in one of them could have occured up to the lowest
+	count of the other, so that is added to its count and its error. Then
+	only the K highest counts are kept. The other topk is left empty.
+
+	@param[in,out] other - The topk to merge into this one.
+	**************************************************************************/
+	void merge( topk & other );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of counters.
+
+	@returns size_t - K.
+	**************************************************************************/
+	size_t capacity() const { return k; }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the number of counters in use.
+
+	@returns size_t - The number of words counted.
+	**************************************************************************/
+	size_t size() const { return counters.size(); }
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function returns the most any count could be too high by, which is
+	the lowest count once every counter is in use.
+
+	@returns size_t - The largest possible error of any count.
+	**************************************************************************/
+	size_t bound() const;
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function empties the topk.
+	**************************************************************************/
+	void clear();
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function prints the counted words in the same format as
+	dictionary::print().
+
+	@param[in,out] txt - The stream to print the words to.
+	@param[in,out] csv - The stream to print the ranks and frequencies to.
+	**************************************************************************/
+	void print( std::ostream & txt, std::ostream & csv ) const;
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function calls a function for every counted word.
+
+	@param[in] visit - The function, which takes the word and its count.
+	**************************************************************************/
+	template <class Visit>
+	void forEach( Visit visit ) const
+	{
+		for ( const counter & c : counters ) visit( std::string_view( c.str ), c.num );
+	}
+
+
+	private:
+
+	/*! @struct
+		@brief The 'counter' struct definition. */
+	struct counter
+	{
+		std::string str; //!< The word being counted.
+
+		size_t num; //!< The count of the word.
+
+		size_t error; //!< How much 'num' could be too high by.
+	};
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function moves a counter down the heap until it is no higher than
+	the counters below it, after its count went up.
+
+	@param[in] pos - The counter's position in the heap.
+	**************************************************************************/
+	void siftDown( size_t pos );
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function moves a counter up the heap until it is no lower than the
+	counter above it.
+
+	@param[in] pos - The counter's position in the heap.
+	**************************************************************************/
+	void siftUp( size_t pos );
+
+	/**********************************************************************//**
+	@author John Colton
+
+	@par Description:
+	This function gets a counter for a word that doesn't have one: a free
+	counter if there is one, and otherwise the counter with the lowest count.
+	The caller must set its count and then move it into place in the heap.
+
+	@param[in] str - The word.
+
+	@returns uint32_t - The index of the counter.
+	**************************************************************************/
+	uint32_t claim( const std::string_view str );
+
+
+	size_t k; //!< The number of counters.
+
+	std::vector<counter> counters; //!< The counters. Never reallocated, since 'index' points into them.
+
+	std::vector<uint32_t> heap; //!< Indexes of the counters, as a min heap by count.
+
+	std::vector<uint32_t> where; //!< The position in 'heap' of each counter.
+
+	std::unordered_map<std::string_view, uint32_t> index; //!< The counter of each word.
+};
+
+
+#endif /* TOPK_H */
@@ -0,0 +1,262 @@
+/**************************************************************************//**
+@file
+
+@brief This file defines the functions the utf8 alphabet uses to read UTF-8.
+
+Characters are decoded from UTF-8 one at a time, and looked up in two tables
+made from the Unicode Character Database: one that says which characters are
+letters, and one that gives the case folded form of every character. Each
+table is split into blocks of characters, and blocks that are the same, such
+as the many blocks with no letters at all, are only stored once, so a lookup
+is just two array reads.
+
+Case folding is the simple kind, the C and S mappings of CaseFolding.txt,
+which maps every character to one character, so that "ΣΊΣΥΦΟΣ" and "σίσυφος"
+are the same word, final sigma and all. Full folding, which turns "ß" into
+"ss", isn't done. A character is only folded if its folded form takes the same
+number of bytes in UTF-8, so folding text never moves any of it. 34 rare
+characters are left as they are because of this, such as the Kelvin sign, the
+long s, and capital sharp s, so "ẞ" isn't the same word as "ß".
+
+There are also two short lists of ranges of characters that don't take one
+column each when printed, for lining up words in columns: marks that combine
+with the letter before them take none, and wide letters, such as Chinese
+characters, take two.
+******************************************************************************/
+
+#ifndef UNICODE_H
+#define UNICODE_H
+
+#include <cstddef>
+#include <cstdint>
+
+
+// What utf8Decode() returns for a byte that doesn't start a valid character.
+#define UTF8_INVALID 0xFFFFFFFFu
+
+// The number of characters in each block of unicodeLetterBits, and of
+// unicodeFoldDelta, as a shift.
+#define UNICODE_LETTER_SHIFT 8
+#define UNICODE_FOLD_SHIFT 7
+
+// The number of blocks in each index. Every character past them is in a block
+// with no letters.
+#define UNICODE_LETTER_BLOCKS 3586
+#define UNICODE_FOLD_BLOCKS 979
+
+// The number of ranges in unicodeZeroWidth, and in unicodeWideLetters.
+#define UNICODE_ZERO_RANGES 333
+#define UNICODE_WIDE_RANGES 42
+
+
+extern const uint8_t unicodeLetterIndex[UNICODE_LETTER_BLOCKS]; //!< The block of letter bits for each block of characters.
+
+extern const uint64_t unicodeLetterBits[][4]; //!< A bit for every character of a block, set if it's a letter.
+
+extern const uint8_t unicodeFoldIndex[UNICODE_FOLD_BLOCKS]; //!< The block of deltas for each block of characters.
+
+extern const int32_t unicodeFoldDelta[][128]; //!< What to add to every character of a block to case fold it.
+
+extern const uint32_t unicodeZeroWidth[UNICODE_ZERO_RANGES][2]; //!< The first and last characters of each range of combining marks, in order.
+
+extern const uint32_t unicodeWideLetters[UNICODE_WIDE_RANGES][2]; //!< The first and last characters of each range of wide letters, in order.
+
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function gets the number of bytes in a UTF-8 character from its first
+byte.
+
+@param[in] lead - The first byte.
+
+@returns unsigned - The number of bytes, or 0 if 'lead' can't start a
+                    character.
+******************************************************************************/
+inline unsigned utf8Length( const unsigned char lead )
+{
+	if ( lead < 0x80 ) return 1;
+	if ( lead < 0xC2 ) return 0;
+	if ( lead < 0xE0 ) return 2;
+	if ( lead < 0xF0 ) return 3;
+
+	return ( lead < 0xF5 ? 4 : 0 );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function decodes one UTF-8 character. Overlong forms, surrogates, and
+characters past U+10FFFF are invalid, as is a character cut off by 'end'. An
+invalid byte is skipped by itself, so decoding picks up again at the next
+character.
+
+@param[in,out] pos - The start of the character, moved past it.
+@param[in] end - The end of the text.
+
+@returns uint32_t - The character, or UTF8_INVALID.
+******************************************************************************/
+inline uint32_t utf8Decode( const char * & pos, const char * const end )
+{
+	// The smallest character each length can hold.
+	static const uint32_t least[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+
+	const unsigned char lead = *pos++;
+	const unsigned length = utf8Length( lead );
+
+	if ( length == 1 ) return lead;
+	if ( !length || size_t( end - pos ) < length - 1 ) return UTF8_INVALID;
+
+	uint32_t cp = lead & ( 0x7F >> length );
+	for ( unsigned i = 0; i < length - 1; ++i )
+	{
+		const unsigned char c = pos[i];
+		if ( ( c & 0xC0 ) != 0x80 ) return UTF8_INVALID;
+
+		cp = ( cp << 6 ) | ( c & 0x3F );
+	}
+
+	if ( cp < least[length] || cp > 0x10FFFF || ( cp >= 0xD800 && cp <= 0xDFFF ) ) return UTF8_INVALID;
+
+	pos += length - 1;
+
+	return cp;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function encodes a character as UTF-8.
+
+@param[in] cp - The character. It must be valid.
+@param[out] out - Where to write it. There must be room for 4 bytes.
+
+@returns unsigned - The number of bytes written.
+******************************************************************************/
+inline unsigned utf8Encode( const uint32_t cp, char * const out )
+{
+	if ( cp < 0x80 )
+	{
+		out[0] = char( cp );
+
+		return 1;
+	}
+
+	if ( cp < 0x800 )
+	{
+		out[0] = char( 0xC0 | cp >> 6 );
+		out[1] = char( 0x80 | ( cp & 0x3F ) );
+
+		return 2;
+	}
+
+	if ( cp < 0x10000 )
+	{
+		out[0] = char( 0xE0 | cp >> 12 );
+		out[1] = char( 0x80 | ( cp >> 6 & 0x3F ) );
+		out[2] = char( 0x80 | ( cp & 0x3F ) );
+
+		return 3;
+	}
+
+	out[0] = char( 0xF0 | cp >> 18 );
+	out[1] = char( 0x80 | ( cp >> 12 & 0x3F ) );
+	out[2] = char( 0x80 | ( cp >> 6 & 0x3F ) );
+	out[3] = char( 0x80 | ( cp & 0x3F ) );
+
+	return 4;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function checks if a character is a letter, or a mark that combines with
+one.
+
+@param[in] cp - The character, or UTF8_INVALID.
+
+@returns bool - True if it's a letter.
+******************************************************************************/
+inline bool unicodeLetter( const uint32_t cp )
+{
+	const uint32_t block = cp >> UNICODE_LETTER_SHIFT;
+	if ( block >= UNICODE_LETTER_BLOCKS ) return false;
+
+	return ( unicodeLetterBits[unicodeLetterIndex[block]][cp >> 6 & 3] >> ( cp & 63 ) ) & 1;
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function case folds a character, with its simple case folding.
+
+@param[in] cp - The character. It must be valid.
+
+@returns uint32_t - Its folded form, which takes the same number of bytes in
+                    UTF-8, or 'cp' if it doesn't have one.
+******************************************************************************/
+inline uint32_t unicodeFold( const uint32_t cp )
+{
+	const uint32_t block = cp >> UNICODE_FOLD_SHIFT;
+	if ( block >= UNICODE_FOLD_BLOCKS ) return cp;
+
+	return uint32_t( int32_t( cp ) + unicodeFoldDelta[unicodeFoldIndex[block]][cp & 127] );
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function checks if a character is in one of a list of ranges.
+
+@param[in] cp - The character.
+@param[in] ranges - The first and last characters of each range, in order.
+@param[in] n - The number of ranges.
+
+@returns bool - True if it's in one of them.
+******************************************************************************/
+inline bool unicodeInRanges( const uint32_t cp, const uint32_t ( * const ranges )[2], const size_t n )
+{
+	if ( cp < ranges[0][0] || cp > ranges[n-1][1] ) return false;
+
+	// Find the last range that starts at or before the character.
+	size_t low = 0, high = n;
+	while ( high - low > 1 )
+	{
+		const size_t mid = ( low + high ) / 2;
+
+		if ( ranges[mid][0] <= cp ) low = mid;
+		else high = mid;
+	}
+
+	return cp <= ranges[low][1];
+}
+
+/**************************************************************************//**
+@author John Colton
+
+@par Description:
+This function finds how many columns a character of a word takes when it's
+printed.
+
+@param[in] cp - The character.
+
+@returns unsigned - 0 for a mark that combines with the letter before it, 2
+                    for a wide letter, and otherwise 1.
+******************************************************************************/
+inline unsigned unicodeWidth( const uint32_t cp )
+{
+	if ( cp < 0x300 ) return 1;
+
+	if ( unicodeInRanges( cp, unicodeZeroWidth, UNICODE_ZERO_RANGES ) ) return 0;
+
+	return ( unicodeInRanges( cp, unicodeWideLetters, UNICODE_WIDE_RANGES ) ? 2 : 1 );
+}
+
+
+#endif /* UNICODE_H */